@@ -69,14 +69,37 @@
  *     MAKE_ENUM_CLASS_DEFINITION(MyEnum, FOREACH_IN_MY_ENUM)
  * <code>
  *
+ * If the helper functions are small enough and called often enough
+ * that the cost of calling them matters, use
+ * <c>MAKE_ENUM_INLINE_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_INLINE_DECLARATION()</c> in the header file
+ * instead.  They define the helper functions as <c>static inline</c>
+ * in the header so there is no corresponding definition macro: <p>
+ *
+ * <code>
+ *     MAKE_ENUM_INLINE_DECLARATION(MyEnum, FOREACH_IN_MY_ENUM)
+ * </code>
+ *
+ * If the elements are bits that are meant to be combined, use
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c> and
+ * <c>MAKE_ENUM_FLAGS_DEFINITION()</c> (or their <c>ENUM_CLASS</c>
+ * counterparts) instead.  <c>EnumName_IsValid()</c> then accepts any
+ * combination of the elements, and <c>EnumName_FlagsToString()</c>,
+ * <c>EnumName_FlagsFromString()</c>, and, for C++, the bitwise
+ * operators are generated too. <p>
+ *
  *
  * C Helper Functions:
  * ==================
  *
  * The C helper functions are <c>EnumName_ToString()</c>,
- * <c>EnumName_FromString()</c>, and <c>EnumName_IsValid()</c> which
- * are summarized as follows (replace "EnumName" with the actual name
- * of the enumeration): <p>
+ * <c>EnumName_ToStringLen()</c>, <c>EnumName_ToStringBatch()</c>,
+ * <c>EnumName_FromString()</c>, <c>EnumName_FromStringN()</c>,
+ * <c>EnumName_FromStringBatch()</c>, <c>EnumName_FromStringCI()</c>,
+ * <c>EnumName_FromStringCIN()</c>, <c>EnumName_IsValid()</c>,
+ * <c>EnumName_ToIndex()</c>, and <c>EnumName_FromIndex()</c> which
+ * are summarized as follows (replace "EnumName" with the actual
+ * name of the enumeration): <p>
  *
  * <pre>
  *   1) // Convert enumeration to string.  For example, if e is set to
@@ -92,17 +115,147 @@
  *                        int with_enum_name,
  *                        int with_element_name);
  *
- *   2) // Convert string to enumeration.  Returns true and sets e to the
+ *      // Same as EnumName_ToString() except the length of the result
+ *      // is also stored in *len if len is not null.  The length is
+ *      // known at compile time so the result is not scanned.
+ *      const char*
+ *      EnumName_ToStringLen(enum EnumName e,
+ *                           int with_enum_name,
+ *                           int with_element_name,
+ *                           size_t* len);
+ *
+ *   2) // Convert the n elements of in to strings separated by sep
+ *      // and write them to out which holds cap bytes.  Like
+ *      // snprintf(), the result is null terminated if cap is not
+ *      // zero, and the return value is the number of bytes needed
+ *      // not counting the terminating null.  The output was
+ *      // truncated if the return value is cap or more.
+ *      size_t
+ *      EnumName_ToStringBatch(const enum EnumName* in,
+ *                             size_t n,
+ *                             char* out,
+ *                             size_t cap,
+ *                             int with_enum_name,
+ *                             int with_element_name,
+ *                             char sep);
+ *
+ *   3) // Convert string to enumeration.  Returns true and sets e to the
  *      // value of the enumeration if the conversion is successful;
  *      // otherwise, returns false.
  *      int
  *      EnumName_FromString(enum EnumName* e,
  *                          const char* s);
  *
- *   3) // Returns true if e is set to a valid enumeration false and
+ *   4) // Same as EnumName_FromString() except s is the n bytes
+ *      // starting at s and does not need to be null terminated.
+ *      int
+ *      EnumName_FromStringN(enum EnumName* e,
+ *                           const char* s,
+ *                           size_t n);
+ *
+ *   5) // Convert the n strings in strs to out[0] through
+ *      // out[n-1].  If lens is null, the strings must be null
+ *      // terminated.  If ok is not null, ok[i] is set to 1 if
+ *      // strs[i] was converted and 0 otherwise.  Returns the number
+ *      // of strings that were converted.
+ *      size_t
+ *      EnumName_FromStringBatch(const char* const* strs,
+ *                               const size_t* lens,
+ *                               size_t n,
+ *                               enum EnumName* out,
+ *                               unsigned char* ok);
+ *
+ *   6) // Convert the tokens separated by delim in [begin, end) to
+ *      // out[0] through out[cap-1] without copying them.  The last
+ *      // token does not need to be followed by delim.  Stops at the
+ *      // first token that is not an element, and sets *consumed, if
+ *      // consumed is not null, to the number of bytes converted
+ *      // including their delimiters.  Returns the number of tokens
+ *      // that were converted.
+ *      size_t
+ *      EnumName_DecodeColumn(const char* begin,
+ *                            const char* end,
+ *                            char delim,
+ *                            enum EnumName* out,
+ *                            size_t cap,
+ *                            size_t* consumed);
+ *
+ *   7) // Same as EnumName_FromString() and EnumName_FromStringN()
+ *      // except ASCII case is ignored, and MAKE_ENUM_ALT_SEPARATOR
+ *      // (which defaults to '.') is accepted in place of "::".
+ *      int
+ *      EnumName_FromStringCI(enum EnumName* e,
+ *                            const char* s);
+ *      int
+ *      EnumName_FromStringCIN(enum EnumName* e,
+ *                             const char* s,
+ *                             size_t n);
+ *
+ *   8) // Returns true if e is set to a valid enumeration false and
  *      // false otherwise.
  *      int
  *      EnumName_IsValid(enum EnumName e);
+ *
+ *   9) // Map each element to its index in [0, count) which is the
+ *      // position of the element in the FOREACH macro.  Returns
+ *      // count if e is not valid.
+ *      size_t
+ *      EnumName_ToIndex(enum EnumName e);
+ *
+ *  10) // Map the index i back to its element.  Returns true and sets
+ *      // e if i is less than count; otherwise, returns false.
+ *      int
+ *      EnumName_FromIndex(enum EnumName* e,
+ *                         size_t i);
+ *
+ *  11) // Write e to buf as the varint of its index.  Returns the
+ *      // number of bytes written or 0 if e is not valid or size is
+ *      // too small.
+ *      size_t
+ *      EnumName_Encode(unsigned char* buf,
+ *                      size_t size,
+ *                      enum EnumName e);
+ *
+ *  12) // Read a varint index from buf into e.  Returns the number of
+ *      // bytes read or 0 if buf does not start with the index of an
+ *      // element.
+ *      size_t
+ *      EnumName_Decode(enum EnumName* e,
+ *                      const unsigned char* buf,
+ *                      size_t size);
+ *
+ *  13) // Pack the indexes of e[0] through e[count-1] into buf using
+ *      // EnumName_MakeEnumBits bits each.  EnumName_PackedSize()
+ *      // returns the number of bytes needed.  EnumName_Pack() returns
+ *      // the number of bytes written or 0 if an element is not valid
+ *      // or size is too small.  EnumName_Unpack() returns the number
+ *      // of elements read which is less than count if buf is too
+ *      // short or holds an index that is out of range.  For a flag
+ *      // enumeration, functions 11 through 13 store the bits of the
+ *      // value instead of an index so every valid combination of
+ *      // flags can be stored.
+ *      size_t
+ *      EnumName_PackedSize(size_t count);
+ *      size_t
+ *      EnumName_Pack(unsigned char* buf,
+ *                    size_t size,
+ *                    const enum EnumName* e,
+ *                    size_t count);
+ *      size_t
+ *      EnumName_Unpack(enum EnumName* e,
+ *                      size_t count,
+ *                      const unsigned char* buf,
+ *                      size_t size);
+ *
+ *  14) // Returns a 64-bit fingerprint of the ordered names and values
+ *      // of the elements.  It changes whenever an element is added,
+ *      // removed, renamed, reordered, or renumbered, so peers can
+ *      // compare it to detect that they were built against different
+ *      // versions of the enumeration.  It is constexpr for C++14.
+ *      // MakeEnum_Uint64 is a structure of two 32-bit halves, hi
+ *      // and lo, for C89.
+ *      MakeEnum_Uint64
+ *      EnumName_SchemaHash(void);
  * </pre>
  *
  *
@@ -121,666 +274,5787 @@
  *               bool with_enum_name,
  *               bool with_element_name);
  *
- *   2) // Convert string to enumeration.
+ *   2) // Convert string to enumeration.  FromStringBatch(),
+ *      // DecodeColumn(), and FromStringCI() are the same as
+ *      // EnumName_FromStringBatch(), EnumName_DecodeColumn(), and
+ *      // EnumName_FromStringCI().  The std::string_view
+ *      // overloads require C++17, and the std::span overload
+ *      // requires C++20.
  *      bool
  *      FromString(EnumName& e,
  *                 const std::string& s)
+ *      bool
+ *      FromString(EnumName& e,
+ *                 const char* s)
+ *      bool
+ *      FromString(EnumName& e,
+ *                 std::string_view s)
+ *      size_t
+ *      FromStringBatch(const std::string* strs,
+ *                      size_t n,
+ *                      EnumName* out,
+ *                      unsigned char* ok)
+ *      size_t
+ *      FromStringBatch(const std::string_view* strs,
+ *                      size_t n,
+ *                      EnumName* out,
+ *                      unsigned char* ok)
+ *      size_t
+ *      FromStringBatch(std::span<const std::string_view> strs,
+ *                      std::span<EnumName> out,
+ *                      unsigned char* ok)
+ *      size_t
+ *      DecodeColumn(const char* begin,
+ *                   const char* end,
+ *                   char delim,
+ *                   EnumName* out,
+ *                   size_t cap,
+ *                   size_t* consumed)
  *
- *   3) // Insertion Operator
+ *   3) // Same as ToString() except the result refers directly to a
+ *      // string literal so nothing is allocated or copied.  The
+ *      // result is a std::string_view for C++17 and a const char*
+ *      // otherwise.  It is constexpr for C++14.
+ *      MAKE_ENUM_STRING_VIEW
+ *      ToStringView(EnumName e,
+ *                   bool with_enum_name,
+ *                   bool with_element_name);
+ *
+ *   4) // Insertion Operator.  The name is written without creating
+ *      // a std::string, and the field width is honored if it is set.
  *      std::ostream&
  *      operator<<(std::ostream& ostrm,
  *                 EnumName e);
  *
- *   4) // Extraction Operator
+ *   5) // Extraction Operator
  *      std::istream&
  *      operator>>(std::istream& istrm,
  *                 EnumName& e);
  *
- *   5) // Returns true if e is set to a valid enumeration false and
+ *   6) // Returns true if e is set to a valid enumeration false and
  *      // false otherwise.
  *      bool
  *      IsValid(EnumName e);
+ *
+ *   7) // Same as EnumName_ToIndex() and EnumName_FromIndex().
+ *      size_t
+ *      ToIndex(EnumName e);
+ *      bool
+ *      FromIndex(EnumName& e,
+ *                size_t i);
+ *
+ *   8) // Same as EnumName_Encode(), EnumName_Decode(),
+ *      // EnumName_Pack(), and EnumName_Unpack().
+ *      size_t
+ *      Encode(unsigned char* buf,
+ *             size_t size,
+ *             EnumName e);
+ *      size_t
+ *      Decode(EnumName& e,
+ *             const unsigned char* buf,
+ *             size_t size);
+ *      size_t
+ *      Pack(unsigned char* buf,
+ *           size_t size,
+ *           const EnumName* e,
+ *           size_t count);
+ *      size_t
+ *      Unpack(EnumName* e,
+ *             size_t count,
+ *             const unsigned char* buf,
+ *             size_t size);
  * </pre>
  *
+ * C++ also gets compile-time traits for each enumeration through
+ * <c>make_enum::EnumTraits<EnumName></c> which has the static
+ * constexpr members <c>count</c>, <c>values[]</c>, <c>names[]</c>,
+ * <c>min</c>, <c>max</c>, and <c>is_dense</c>.  The traits size the
+ * <c>make_enum::EnumMap<EnumName, T></c> flat map and the
+ * <c>make_enum::EnumSet<EnumName></c> bitset which are both indexed
+ * by <c>ToIndex()</c>.  <c>make_enum::Dispatch(e, visitor)</c>
+ * calls <c>visitor</c> with a <c>std::integral_constant</c> tag for
+ * the element <c>e</c> through a table of function pointers indexed
+ * the same way.  If MAKE_ENUM_STD_FORMAT or MAKE_ENUM_FMT is
+ * defined, <c>std::formatter</c> or <c>fmt::formatter</c> is
+ * specialized for each enumeration too.
+ *
  * @file
  */
 
+#include <limits.h>
 #include <stddef.h>
 #include <string.h>
+#if !defined(__cplusplus) && \
+    defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)
+#include <stdint.h>
+#endif
 
 #ifdef __cplusplus
 #include <iostream>
+#include <locale>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <stdint.h>
+#ifdef MAKE_ENUM_STD_FORMAT
+#include <format>
+#endif
+#ifdef MAKE_ENUM_FMT
+#include <fmt/format.h>
+#endif
 #endif
 
 /************************************************************************
- * ToString() -- You should not need to use these macros directly.
+ * Internal Helpers -- You should not need to use these macros directly.
  ************************************************************************/
 
+#ifdef __cplusplus
 /**
- * Internal macro for declaring the <c>EnumName_ToString()</c>
- * function.  <c>EnumName</c> should be the same as the values passed
- * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
- *
- * @param EnumName enumeration name
+ * The C++ standard in effect.  MSVC++ leaves <c>__cplusplus</c> at
+ * 199711L unless /Zc:__cplusplus is given so prefer
+ * <c>_MSVC_LANG</c> when it is available.
  */
-#define MAKE_ENUM_TO_STRING_DECLARATION_BASE(EnumName)  \
-    const char*                                         \
-    EnumName##_ToString(enum EnumName e,                \
-                        int with_enum_name,             \
-                        int with_element_name);
+#if defined(_MSVC_LANG) && _MSVC_LANG > __cplusplus
+#define MAKE_ENUM_CXX_STD _MSVC_LANG
+#else
+#define MAKE_ENUM_CXX_STD __cplusplus
+#endif
 
-#ifndef __cplusplus
+#if MAKE_ENUM_CXX_STD >= 201703L
+#include <string_view>
+#endif
+#if MAKE_ENUM_CXX_STD >= 202002L
+#include <span>
+#endif
+#endif  /*  __cplusplus  */
+
+#ifdef __cplusplus
+#if MAKE_ENUM_CXX_STD >= 201703L
 /**
- * C version of internal macro for declaring the
- * <c>EnumName_ToString()</c> function for an <c>enum</c>.
- * <c>EnumName</c> should be the same as the values passed into the
- * corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * Type returned by <c>ToStringView()</c>.
+ */
+#define MAKE_ENUM_STRING_VIEW std::string_view
+
+/**
+ * Internal macro that converts the string literal <c>s</c> to a
+ * <c>MAKE_ENUM_STRING_VIEW</c> without having to scan it for its
+ * length.
  *
- * @param EnumName enumeration name
+ * @param s string literal
  */
-#define MAKE_ENUM_TO_STRING_DECLARATION(EnumName)   \
-    MAKE_ENUM_TO_STRING_DECLARATION_BASE(EnumName)
+#define MAKE_ENUM_STRING_VIEW_LITERAL(s) std::string_view(s, sizeof(s) - 1)
 #else
 /**
- * C++ version of internal macro for declaring the
- * <c>EnumName_ToString()</c> function as well as overloaded
- * <c>ToString()</c> and <c>operator<<()</c> functions for an
- * <c>enum</c>.  <c>EnumName</c> should be the same as the values
- * passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
- *
- * @param EnumName enumeration name
+ * Type returned by <c>ToStringView()</c>.  It is a pointer to a null
+ * terminated string literal because <c>std::string_view</c> requires
+ * C++17.
  */
-#define MAKE_ENUM_TO_STRING_DECLARATION(EnumName)   \
-    MAKE_ENUM_TO_STRING_DECLARATION_BASE(EnumName)  \
-                                                    \
-    std::string                                     \
-    ToString(EnumName e,                            \
-             bool with_enum_name = false,           \
-             bool with_element_name = true);        \
-                                                    \
-    std::ostream&                                   \
-    operator<<(std::ostream& ostrm,                 \
-               EnumName e);
+#define MAKE_ENUM_STRING_VIEW const char*
 
 /**
- * C++ version of internal macro for declaring the
- * <c>EnumName_ToString()</c> function as well as overloaded
- * <c>ToString()</c> and <c>operator<<()</c> functions for an
- * <c>enum</c>.  <c>EnumName</c> should be the same as the values
- * passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal macro that converts the string literal <c>s</c> to a
+ * <c>MAKE_ENUM_STRING_VIEW</c>.
  *
- * @param EnumName enumeration name
+ * @param s string literal
  */
-#define MAKE_ENUM_CLASS_TO_STRING_DECLARATION(EnumName) \
-    MAKE_ENUM_TO_STRING_DECLARATION_BASE(EnumName)      \
-                                                        \
-    std::string                                         \
-    ToString(EnumName e,                                \
-             bool with_enum_name = true,                \
-             bool with_element_name = true);            \
-                                                        \
-    std::ostream&                                       \
-    operator<<(std::ostream& ostrm,                     \
-               EnumName e);
+#define MAKE_ENUM_STRING_VIEW_LITERAL(s) (s)
 #endif
+#endif  /*  __cplusplus  */
 
 /**
- * Internal X macro for converting the enumeration element
- * <c>ElementName</c> for the enumeration <c>EnumName</c> to a string.
- *
- * @param EnumName enumeration name
- * @param ElementName enumeration element name
- * @param ElementValue enumeration element element (not used)
+ * Internal macro for the specifier of the helper functions that are
+ * declared in a header file and defined in a source file.  The
+ * helper functions have external linkage either way, but it is not
+ * empty because passing an empty argument to a macro is undefined in
+ * C89.
  */
-#define X_MAKE_ENUM_TO_STRING(EnumName,                     \
-                              ElementName,                  \
-                              ElementValue)                 \
-    case ElementName:                                       \
-        if (with_enum_name && with_element_name) {          \
-            result = #EnumName "::" #ElementName;           \
-        } else if (with_enum_name && !with_element_name) {  \
-            result = #EnumName;                             \
-        } else if (!with_enum_name && with_element_name) {  \
-            result = #ElementName;                          \
-        } else {                                            \
-            result = "";                                    \
-        }                                                   \
-        break;
+#define MAKE_ENUM_EXTERN extern
 
-#ifdef __cplusplus
 /**
- * Internal X macro for converting the enumeration element
- * <c>ElementName</c> for the scoped enumeration <c>EnumName</c> to a
- * string.
+ * Internal macro for the specifier of the helper functions that are
+ * declared and defined in a header file by
+ * <c>MAKE_ENUM_INLINE_DECLARATION()</c>.  The helper functions are
+ * static so each translation unit gets its own copy that the
+ * optimizer can inline, and they are inline so unused copies do not
+ * generate warnings.  C89 does not have <c>inline</c>, so the
+ * compiler-specific spelling is used when it is available.
+ */
+#if defined(__cplusplus) || \
+    (defined(__STDC_VERSION__) && __STDC_VERSION__ >= 199901L)
+#define MAKE_ENUM_INLINE static inline
+#elif defined(__GNUC__)
+#define MAKE_ENUM_INLINE static __inline__
+#elif defined(_MSC_VER)
+#define MAKE_ENUM_INLINE static __inline
+#else
+#define MAKE_ENUM_INLINE static
+#endif
+
+/**
+ * Character that is accepted in place of "::" between the name of
+ * the enumeration and the name of the element by
+ * <c>EnumName_FromStringCI()</c>.  Define it before including this
+ * file to accept a different separator.  It should not be a character
+ * that can appear in the name of an element.
+ */
+#ifndef MAKE_ENUM_ALT_SEPARATOR
+#define MAKE_ENUM_ALT_SEPARATOR '.'
+#endif
+
+/*
+ * Define MAKE_ENUM_LEAN before including this file to expand the
+ * FOREACH macro of each enumeration fewer times at the cost of some
+ * speed.  For C++14, <c>ToStringView()</c> is no longer
+ * <c>constexpr</c> so its <c>switch</c> statement is not compiled in
+ * every file that includes the declaration, and the names are not
+ * sorted at compile time for <c>EnumName_FromString()</c> and
+ * <c>EnumName_FromStringCI()</c>.  For C,
+ * <c>EnumName_IsValid()</c> no longer uses a bitmap so the two sums
+ * that build it are not expanded.
+ */
+
+/*
+ * Define MAKE_ENUM_STD_FORMAT before including this file to specialize
+ * <c>std::formatter</c> (C++20) for every enumeration, and define
+ * MAKE_ENUM_FMT to specialize <c>fmt::formatter</c> from {fmt}.  The
+ * elements are then formatted by copying their names directly to the
+ * output without creating a <c>std::string</c>.  The format spec may
+ * start with "q" for the qualified name "EnumName::ElementName" or
+ * "u" for the unqualified name "ElementName"; otherwise, the name is
+ * the same as for <c>operator<<()</c>.  The rest of the spec is the
+ * same as for a string, so the fill, alignment, and width work.
+ */
+
+/*
+ * Define MAKE_ENUM_INSTRUMENTED before including this file to count
+ * how often each element is converted by <c>EnumName_FromString()</c>
+ * and <c>EnumName_ToString()</c> along with how often
+ * <c>EnumName_FromString()</c> and <c>EnumName_IsValid()</c> fail.
+ * The counts are read by <c>EnumName_UsageSnapshot()</c> and
+ * <c>EnumName_UsageDump()</c>.  When it is not defined, neither the
+ * counters nor the functions that read them are generated.
+ */
+#ifdef MAKE_ENUM_INSTRUMENTED
+#include <stdio.h>
+
+/**
+ * Size in bytes of a cache line.  The counters of each element are
+ * aligned to it so threads converting different elements do not
+ * write to the same cache line.  Define it before including this file
+ * if the cache line of your processor is not 64 bytes.
+ */
+#ifndef MAKE_ENUM_CACHE_LINE_SIZE
+#define MAKE_ENUM_CACHE_LINE_SIZE 64
+#endif
+
+#if defined(__cplusplus)
+#include <atomic>
+/**
+ * Internal counter type that can be incremented from any thread
+ * without a lock.
+ */
+typedef std::atomic<size_t> MakeEnum_AtomicSize;
+#define MAKE_ENUM_CACHE_ALIGNED alignas(MAKE_ENUM_CACHE_LINE_SIZE)
+#define MAKE_ENUM_COUNTER_INCREMENT(c) \
+    ((void)(c).fetch_add(1, std::memory_order_relaxed))
+#define MAKE_ENUM_COUNTER_LOAD(c) ((c).load(std::memory_order_relaxed))
+#define MAKE_ENUM_COUNTER_RESET(c) ((c).store(0, std::memory_order_relaxed))
+#elif defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && \
+    !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+typedef atomic_size_t MakeEnum_AtomicSize;
+#define MAKE_ENUM_CACHE_ALIGNED _Alignas(MAKE_ENUM_CACHE_LINE_SIZE)
+#define MAKE_ENUM_COUNTER_INCREMENT(c) \
+    ((void)atomic_fetch_add_explicit(&(c), 1, memory_order_relaxed))
+#define MAKE_ENUM_COUNTER_LOAD(c) \
+    atomic_load_explicit(&(c), memory_order_relaxed)
+#define MAKE_ENUM_COUNTER_RESET(c) \
+    atomic_store_explicit(&(c), 0, memory_order_relaxed)
+#elif defined(__GNUC__)
+typedef size_t MakeEnum_AtomicSize;
+#define MAKE_ENUM_CACHE_ALIGNED \
+    __attribute__((aligned(MAKE_ENUM_CACHE_LINE_SIZE)))
+#define MAKE_ENUM_COUNTER_INCREMENT(c) \
+    ((void)__atomic_fetch_add(&(c), 1, __ATOMIC_RELAXED))
+#define MAKE_ENUM_COUNTER_LOAD(c) __atomic_load_n(&(c), __ATOMIC_RELAXED)
+#define MAKE_ENUM_COUNTER_RESET(c) __atomic_store_n(&(c), 0, __ATOMIC_RELAXED)
+#else
+#error "MAKE_ENUM_INSTRUMENTED requires C++11, C11 atomics, or GCC."
+#endif
+
+/**
+ * Internal counters for one element.  The alignment of the first
+ * member pads the structure out to a whole cache line.
+ */
+struct MakeEnum_ElementCounters {
+    MAKE_ENUM_CACHE_ALIGNED MakeEnum_AtomicSize from_string;
+    MakeEnum_AtomicSize to_string;
+};
+
+/**
+ * Internal counter padded out to a whole cache line.
+ */
+struct MakeEnum_Counter {
+    MAKE_ENUM_CACHE_ALIGNED MakeEnum_AtomicSize value;
+};
+
+/**
+ * Internal helper that increments the counter <c>Counter</c> of the
+ * enumeration <c>EnumName</c> which must have been defined by
+ * <c>MAKE_ENUM_USAGE_COUNTERS_DEFINITION()</c>.
  *
  * @param EnumName enumeration name
- * @param ElementName enumeration element name
- * @param ElementValue enumeration element element (not used)
+ * @param Counter member of <c>EnumName_MakeEnumUsageCounters</c>
  */
-#define X_MAKE_ENUM_CLASS_TO_STRING(EnumName,               \
-                                    ElementName,            \
-                                    ElementValue)           \
-    case EnumName::ElementName:                             \
-        if (with_enum_name && with_element_name) {          \
-            result = #EnumName "::" #ElementName;           \
-        } else if (with_enum_name && !with_element_name) {  \
-            result = #EnumName;                             \
-        } else if (!with_enum_name && with_element_name) {  \
-            result = #ElementName;                          \
-        } else {                                            \
-            result = "";                                    \
-        }                                                   \
-        break;
-#endif  /*  __cplusplus  */
+#define MAKE_ENUM_COUNT(EnumName, Counter) \
+    MAKE_ENUM_COUNTER_INCREMENT(EnumName##_MakeEnumUsageCounters.Counter)
+#else
+/**
+ * Internal helper that does nothing because
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is not defined.
+ *
+ * @param EnumName enumeration name (not used)
+ * @param Counter member of <c>EnumName_MakeEnumUsageCounters</c> (not used)
+ */
+#define MAKE_ENUM_COUNT(EnumName, Counter) ((void)0)
+#endif  /*  MAKE_ENUM_INSTRUMENTED  */
 
 /**
- * Internal macro for defining the <c>EnumName_ToString()</c> function
- * for an <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c>
- * should be the same as the values passed into the corresponding call
- * to <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal helper that returns the ASCII character <c>c</c> converted
+ * to lowercase.  Unlike <c>tolower()</c>, it does not depend on the
+ * locale.
+ */
+#define MAKE_ENUM_FOLD_CASE(c) \
+    ((((c) >= 'A') && ((c) <= 'Z')) ? (char)((c) - 'A' + 'a') : (c))
+
+/**
+ * Internal helper that returns true if the <c>n</c> bytes starting at
+ * <c>a</c> are the same as the <c>n</c> bytes starting at <c>b</c>
+ * ignoring ASCII case.
  *
- * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
- * @param X macro to apply to each element
+ * @param a first string
+ * @param b second string
+ * @param n number of bytes to compare
  */
-#define MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(EnumName,         \
-                                              ForeachInEnum,    \
-                                              X)                \
-    const char*                                                 \
-    EnumName##_ToString(enum EnumName e,                        \
-                        int with_enum_name,                     \
-                        int with_element_name)                  \
-    {                                                           \
-        const char* result = "";                                \
-        switch (e) {                                            \
-            ForeachInEnum(EnumName, X)                          \
-        default:                                                \
-            result = "";                                        \
-            break;                                              \
-        }                                                       \
-        return result;                                          \
+MAKE_ENUM_INLINE int
+MakeEnum_EqualIgnoreCase(const char* a,
+                         const char* b,
+                         size_t n)
+{
+    size_t i = 0;
+    for (i = 0; i < n; ++i) {
+        if (MAKE_ENUM_FOLD_CASE(a[i]) != MAKE_ENUM_FOLD_CASE(b[i])) {
+            return 0;
+        }
     }
+    return 1;
+}
 
-#ifdef __cplusplus
 /**
- * Internal macro for defining the overloaded <c>ToString()</c> and
- * <c>operator<<()</c> functions for an <c>enum</c> or an <c>enum
- * class</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be the
- * same as the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c> or
- * <c>MAKE_ENUM_CLASS_DECLARATION()</c>. <p>
+ * Internal helper that returns the number of bits needed to hold
+ * <c>x</c>, which is the position of its highest set bit plus one,
+ * or zero if <c>x</c> is zero.
  *
- * This macro works for both <c>enum</c> and <c>enum class</c>
- * enumerations because the enum logic is in the
- * <c>EnumName_ToString()</c> function which is defined elsewhere.
- * Also, the *declaration* macros are responsible for setting the
- * default values differently for <c>enum</c> and <c>enum class</c> so
- * the former default to generating just the element name (e.g.,
- * "FOO") while the later default to generating the full, scoped name
- * (e.g., "MyEnum::FOO"). <p>
+ * @param x value to measure
+ */
+MAKE_ENUM_INLINE unsigned int
+MakeEnum_BitWidth(unsigned long x)
+{
+    unsigned int result = 0;
+    for (; x; x >>= 1) {
+        ++result;
+    }
+    return result;
+}
+
+#ifndef __cplusplus
+/**
+ * Internal helper that returns the index of the lowest bit that is
+ * set in <c>x</c> which must not be zero.  C++ uses
+ * <c>make_enum::detail::CountTrailingZeros()</c> instead.  See
+ * <c>MAKE_ENUM_COUNT_TRAILING_ZEROS()</c>.
  *
- * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param x value to measure
  */
-#define MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(EnumName,       \
-                                                ForeachInEnum)  \
-    std::string                                                 \
-    ToString(EnumName e,                                        \
-             bool with_enum_name,                               \
-             bool with_element_name)                            \
-    {                                                           \
-        return EnumName##_ToString(e,                           \
-                                   with_enum_name,              \
-                                   with_element_name);          \
-    }                                                           \
-                                                                \
-    std::ostream&                                               \
-    operator<<(std::ostream& ostrm,                             \
-               EnumName e)                                      \
-    {                                                           \
-        ostrm << ToString(e);                                   \
-        return ostrm;                                           \
+MAKE_ENUM_INLINE unsigned int
+MakeEnum_CountTrailingZeros(unsigned long x)
+{
+#if defined(__GNUC__)
+    return (unsigned int)__builtin_ctzl(x);
+#else
+    unsigned int result = 0;
+    for (; (x & 1UL) == 0; x >>= 1) {
+        ++result;
     }
+    return result;
 #endif
+}
+#endif  /*  __cplusplus  */
 
-#ifndef __cplusplus
 /**
- * C version of internal macro for defining the
- * <c>EnumName_ToString()</c> function for an <c>enum</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal unsigned 64-bit integer type for C and C++.  C89 has no
+ * such type, so unless the compiler is Microsoft's, it holds the
+ * upper and lower 32 bits in two <c>unsigned long</c> halves.
+ */
+#if defined(__cplusplus) || \
+    (defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 199901L))
+typedef uint64_t MakeEnum_Uint64;
+#define MAKE_ENUM_HAS_UINT64 1
+#elif defined(_MSC_VER)
+typedef unsigned __int64 MakeEnum_Uint64;
+#define MAKE_ENUM_HAS_UINT64 1
+#else
+typedef struct MakeEnum_Uint64 {
+    unsigned long hi;
+    unsigned long lo;
+} MakeEnum_Uint64;
+#define MAKE_ENUM_HAS_UINT64 0
+#endif
+
+/**
+ * Internal helper that expands to <c>constexpr</c> for C++14 and
+ * later which allow loops in <c>constexpr</c> functions.
+ */
+#if defined(__cplusplus) && MAKE_ENUM_CXX_STD >= 201402L
+#define MAKE_ENUM_CONSTEXPR14 constexpr
+#else
+#define MAKE_ENUM_CONSTEXPR14
+#endif
+
+#if MAKE_ENUM_HAS_UINT64
+/**
+ * Internal macro for the 64-bit FNV-1a offset basis that starts the
+ * schema hash.  It is built from two 32-bit halves so it does not
+ * need a 64-bit integer literal.
+ */
+#define MAKE_ENUM_SCHEMA_HASH_BASIS \
+    (((MakeEnum_Uint64)0xcbf29ce4UL << 32) | 0x84222325UL)
+
+/**
+ * Internal macro that converts the value of an enumeration element
+ * to 64 bits for the schema hash.
  *
- * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param value value of an enumeration element
  */
-#define MAKE_ENUM_TO_STRING_DEFINITION(EnumName,                    \
-                                       ForeachInEnum)               \
-    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(EnumName,                 \
-                                          ForeachInEnum,            \
-                                          X_MAKE_ENUM_TO_STRING)
+#define MAKE_ENUM_SCHEMA_HASH_VALUE(value) ((MakeEnum_Uint64)(value))
+
+/**
+ * Internal helper that folds one element into the schema hash
+ * <c>h</c> using 64-bit FNV-1a.  The bytes of <c>name</c> including
+ * its terminating null are hashed followed by the 8 bytes of
+ * <c>value</c> from least to most significant, so the result only
+ * depends on the names and values and not on the platform.  It is
+ * <c>constexpr</c> for C++14 so C and C++ compute the same hash.
+ *
+ * @param h hash of the preceding elements
+ * @param name null-terminated name of the element
+ * @param value value of the element converted to 64 bits
+ */
+MAKE_ENUM_CONSTEXPR14 MAKE_ENUM_INLINE MakeEnum_Uint64
+MakeEnum_SchemaHashStep(MakeEnum_Uint64 h,
+                        const char* name,
+                        MakeEnum_Uint64 value)
+{
+    const MakeEnum_Uint64 prime = ((MakeEnum_Uint64)0x100UL << 32) | 0x1b3UL;
+    int i = 0;
+    do {
+        h = (h ^ (unsigned char)*name) * prime;
+    } while (*name++ != '\0');
+    for (i = 0; i < 8; ++i) {
+        h = (h ^ ((value >> (8 * i)) & 0xff)) * prime;
+    }
+    return h;
+}
 #else
 /**
- * C++ version of internal macro for defining the
- * <c>EnumName_ToString()</c> function as well as overloaded
- * <c>ToString()</c> and <c>operator<<()</c> functions for an
- * <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be
- * the same as the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * C89 version of internal macro for the 64-bit FNV-1a offset basis
+ * that starts the schema hash.
+ */
+#define MAKE_ENUM_SCHEMA_HASH_BASIS MakeEnum_SchemaHashBasis()
+
+/**
+ * C89 version of internal macro that converts the value of an
+ * enumeration element to 64 bits for the schema hash.  The value is
+ * an <c>int</c> so the upper half is just its sign.
  *
- * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param value value of an enumeration element
  */
-#define MAKE_ENUM_TO_STRING_DEFINITION(EnumName,                        \
-                                       ForeachInEnum)                   \
-    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(EnumName,                     \
-                                          ForeachInEnum,                \
-                                          X_MAKE_ENUM_TO_STRING)        \
-    MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
+#define MAKE_ENUM_SCHEMA_HASH_VALUE(value) \
+    MakeEnum_SchemaHashValue((long)(value))
 
 /**
- * Internal macro for defining the <c>EnumName_ToString()</c> function
- * as well as overloaded <c>ToString()</c> and <c>operator<<()</c>
- * functions for an <c>enum class</c>.  <c>EnumName</c> and
- * <c>ForeachInEnum</c> should be the same as the values passed into
- * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal helper that returns the 64-bit FNV-1a offset basis.
+ */
+MAKE_ENUM_INLINE MakeEnum_Uint64
+MakeEnum_SchemaHashBasis(void)
+{
+    MakeEnum_Uint64 result;
+    result.hi = 0xcbf29ce4UL;
+    result.lo = 0x84222325UL;
+    return result;
+}
+
+/**
+ * Internal helper that sign extends <c>value</c> to 64 bits.
  *
- * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param value value of an enumeration element
  */
-#define MAKE_ENUM_CLASS_TO_STRING_DEFINITION(EnumName,                  \
-                                             ForeachInEnum)             \
-    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(EnumName,                     \
-                                          ForeachInEnum,                \
-                                          X_MAKE_ENUM_CLASS_TO_STRING)  \
-    MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
-#endif  /*  __cplusplus  */
+MAKE_ENUM_INLINE MakeEnum_Uint64
+MakeEnum_SchemaHashValue(long value)
+{
+    MakeEnum_Uint64 result;
+    result.hi = (value < 0) ? 0xffffffffUL : 0UL;
+    result.lo = (unsigned long)value & 0xffffffffUL;
+    return result;
+}
 
-/************************************************************************
- * FromString() -- You should not need to use these macros directly.
- ************************************************************************/
+/**
+ * Internal helper that folds the byte <c>b</c> into the schema hash
+ * <c>h</c> by XORing it into the lowest byte and multiplying by the
+ * 64-bit FNV prime, 2^40 + 0x1b3.  The product is computed in 16-bit
+ * pieces so no intermediate result needs more than 32 bits.
+ *
+ * @param h hash of the preceding bytes
+ * @param b byte to hash
+ */
+MAKE_ENUM_INLINE MakeEnum_Uint64
+MakeEnum_SchemaHashByte(MakeEnum_Uint64 h,
+                        unsigned long b)
+{
+    unsigned long a0 = (h.lo ^ b) & 0xffffUL;
+    unsigned long a1 = (h.lo >> 16) & 0xffffUL;
+    unsigned long a2 = h.hi & 0xffffUL;
+    unsigned long a3 = (h.hi >> 16) & 0xffffUL;
+    unsigned long r0 = a0 * 0x1b3UL;
+    unsigned long r1 = a1 * 0x1b3UL + (r0 >> 16);
+    unsigned long r2 = a2 * 0x1b3UL + a0 * 0x100UL + (r1 >> 16);
+    unsigned long r3 = a3 * 0x1b3UL + a1 * 0x100UL + (r2 >> 16);
+    h.lo = ((r1 & 0xffffUL) << 16) | (r0 & 0xffffUL);
+    h.hi = ((r3 & 0xffffUL) << 16) | (r2 & 0xffffUL);
+    return h;
+}
 
 /**
- * Internal macro for declaring the <c>EnumName_FromString()</c>
- * function.  <c>EnumName</c> should be the same as the values passed
- * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * C89 version of internal helper that folds one element into the
+ * schema hash <c>h</c> using 64-bit FNV-1a.  It hashes the same bytes
+ * in the same order as the other versions, so it gives the same
+ * result.
  *
- * @param EnumName enumeration name
+ * @param h hash of the preceding elements
+ * @param name null-terminated name of the element
+ * @param value value of the element converted to 64 bits
  */
-#define MAKE_ENUM_FROM_STRING_DECLARATION_BASE(EnumName) \
-    int                                                  \
-    EnumName##_FromString(enum EnumName* e,              \
-                          const char* s);
+MAKE_ENUM_INLINE MakeEnum_Uint64
+MakeEnum_SchemaHashStep(MakeEnum_Uint64 h,
+                        const char* name,
+                        MakeEnum_Uint64 value)
+{
+    int i = 0;
+    do {
+        h = MakeEnum_SchemaHashByte(h, (unsigned char)*name);
+    } while (*name++ != '\0');
+    for (i = 0; i < 4; ++i) {
+        h = MakeEnum_SchemaHashByte(h, (value.lo >> (8 * i)) & 0xffUL);
+    }
+    for (i = 0; i < 4; ++i) {
+        h = MakeEnum_SchemaHashByte(h, (value.hi >> (8 * i)) & 0xffUL);
+    }
+    return h;
+}
+#endif  /*  MAKE_ENUM_HAS_UINT64  */
 
 #ifndef __cplusplus
 /**
- * C version of internal macro for declaring the
- * <c>EnumName_FromString()</c> function.  <c>EnumName</c> should be
- * the same as the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal macro that names the enumeration element
+ * <c>ElementName</c> from outside the body of the enumeration.
  *
- * @param EnumName enumeration name
+ * @param EnumName enumeration name (not used)
+ * @param ElementName enumeration element name
+ */
+#define MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) ElementName
+
+/**
+ * Internal macro for the qualifiers of the static tables generated
+ * for each enumeration.
  */
-#define MAKE_ENUM_FROM_STRING_DECLARATION(EnumName) \
-    MAKE_ENUM_FROM_STRING_DECLARATION_BASE(EnumName)
+#define MAKE_ENUM_TABLE_CONST const
 #else
 /**
- * C++ version of internal macro for declaring the
- * <c>EnumName_FromString()</c> function as well as overloaded
- * <c>FromString()</c> and <c>operator>>()</c> functions.
- * <c>EnumName</c> should be the same as the values passed into the
- * corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal macro that names the enumeration element
+ * <c>ElementName</c> from outside the body of the enumeration.  C++11
+ * allows elements of both <c>enum</c> and <c>enum class</c> to be
+ * qualified with the name of the enumeration.
  *
  * @param EnumName enumeration name
+ * @param ElementName enumeration element name
  */
-#define MAKE_ENUM_FROM_STRING_DECLARATION(EnumName)     \
-    MAKE_ENUM_FROM_STRING_DECLARATION_BASE(EnumName)    \
-                                                        \
-    bool                                                \
-    FromString(EnumName& e,                             \
-               const std::string& s);                   \
-                                                        \
-    std::istream&                                       \
-    operator>>(std::istream& istrm,                     \
-               EnumName& e);
-#endif
+#define MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) \
+    EnumName::ElementName
+
+/**
+ * Internal macro for the qualifiers of the static tables generated
+ * for each enumeration.  The tables are <c>constexpr</c> in C++ so
+ * they can be used to build other tables at compile time.
+ */
+#define MAKE_ENUM_TABLE_CONST constexpr
+#endif  /*  __cplusplus  */
+
+/**
+ * Internal macro for the number of bits in the bitmap of valid values
+ * generated by <c>MAKE_ENUM_BITMAP_DEFINITION()</c>.
+ */
+#define MAKE_ENUM_BITMAP_BITS (sizeof(unsigned long) * 8)
+
+/**
+ * Internal macro for the number of bits needed to store an index in
+ * <c>[0, n)</c> which is <c>ceil(log2(n))</c> but at least one.  It
+ * is a constant expression so it can initialize an enumeration
+ * constant in C.  It stops at 24 bits which is more than any
+ * enumeration will need.
+ *
+ * @param n number of elements
+ */
+#define MAKE_ENUM_INDEX_BITS(n)                                         \
+    (1 + ((n) > 0x2L) + ((n) > 0x4L) + ((n) > 0x8L)                     \
+     + ((n) > 0x10L) + ((n) > 0x20L) + ((n) > 0x40L) + ((n) > 0x80L)    \
+     + ((n) > 0x100L) + ((n) > 0x200L) + ((n) > 0x400L)                 \
+     + ((n) > 0x800L) + ((n) > 0x1000L) + ((n) > 0x2000L)               \
+     + ((n) > 0x4000L) + ((n) > 0x8000L) + ((n) > 0x10000L)             \
+     + ((n) > 0x20000L) + ((n) > 0x40000L) + ((n) > 0x80000L)           \
+     + ((n) > 0x100000L) + ((n) > 0x200000L) + ((n) > 0x400000L)        \
+     + ((n) > 0x800000L))
 
 /**
- * Internal X macro for converting the string <c>s</c> to an
- * enumeration.  This works for both the scoped and unscoped
- * enumeration names, e.g., "MyEnum::FOO" and "FOO".
+ * Internal X macro for declaring the index of the enumeration element
+ * <c>ElementName</c>.  Elements are numbered from zero in the order
+ * they appear in <c>ForeachInEnum</c>.
  *
  * @param EnumName enumeration name
  * @param ElementName enumeration element name
  * @param ElementValue enumeration element element (not used)
  */
-#define X_MAKE_ENUM_FROM_STRING(EnumName,                       \
-                                ElementName,                    \
-                                ElementValue)                   \
-    else if ((strcmp(s, #EnumName "::" #ElementName) == 0) ||   \
-             (strcmp(s, #ElementName) == 0))                    \
-    {                                                           \
-        *e = ElementName;                                       \
-        result = 1;                                             \
-    }
+#define X_MAKE_ENUM_INDEX(EnumName,                                 \
+                          ElementName,                              \
+                          ElementValue)                             \
+    EnumName##_MakeEnumIndex_##ElementName,
 
-#ifdef __cplusplus
+#ifndef __cplusplus
 /**
- * Internal X macro for converting the string <c>s</c> to an
- * enumeration.  This works for both the scoped and unscoped
- * enumeration names, e.g., "MyEnum::FOO" and "FOO".
+ * Internal X macro for finding the value of the first enumeration
+ * element by summing the value of every element that has an index of
+ * zero.
  *
  * @param EnumName enumeration name
  * @param ElementName enumeration element name
  * @param ElementValue enumeration element element (not used)
  */
-#define X_MAKE_ENUM_CLASS_FROM_STRING(EnumName,                 \
-                                      ElementName,              \
-                                      ElementValue)             \
-    else if ((strcmp(s, #EnumName "::" #ElementName) == 0) ||   \
-             (strcmp(s, #ElementName) == 0))                    \
-    {                                                           \
-        *e = EnumName::ElementName;                             \
-        result = 1;                                             \
-    }
+#define X_MAKE_ENUM_FIRST(EnumName,                                 \
+                          ElementName,                              \
+                          ElementValue)                             \
+    + ((EnumName##_MakeEnumIndex_##ElementName == 0)                \
+       ? (long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName)      \
+       : 0L)
+
+/**
+ * Internal X macro for counting the enumeration elements whose value
+ * is the value of the first element plus the index of the element.
+ * The arithmetic is unsigned so it cannot overflow.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_IS_SEQUENTIAL(EnumName,                         \
+                                  ElementName,                      \
+                                  ElementValue)                     \
+    + (((unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) \
+        - (unsigned long)EnumName##_MakeEnumFirst)                  \
+       == (unsigned long)EnumName##_MakeEnumIndex_##ElementName)
+
+/**
+ * Internal macro for declaring <c>EnumName_MakeEnumFirst</c> and
+ * <c>EnumName_MakeEnumIsSequential</c> for C.  Both are sums over
+ * every element.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_SEQUENCE_DECLARATION(EnumName, ForeachInEnum)     \
+    enum {                                                          \
+        EnumName##_MakeEnumFirst =                                  \
+            (int)(0L ForeachInEnum(EnumName, X_MAKE_ENUM_FIRST)),   \
+        EnumName##_MakeEnumIsSequential =                           \
+            ((0 ForeachInEnum(EnumName, X_MAKE_ENUM_IS_SEQUENTIAL)) \
+             == EnumName##_MakeEnumCount)                           \
+    };
+#else
+/**
+ * Internal X macro for adding the enumeration element
+ * <c>ElementName</c> to the array of values generated by
+ * <c>MAKE_ENUM_SEQUENCE_DECLARATION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_VALUE(EnumName,                                 \
+                          ElementName,                              \
+                          ElementValue)                             \
+    MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName),
+
+/**
+ * Internal macro for declaring <c>EnumName_MakeEnumFirst</c> and
+ * <c>EnumName_MakeEnumIsSequential</c> for C++.  C++ compilers take
+ * time that is quadratic in the number of terms to fold a long sum,
+ * so the values are placed in an array and checked by
+ * <c>make_enum::detail::IsSequential()</c> instead.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_SEQUENCE_DECLARATION(EnumName, ForeachInEnum)     \
+    static constexpr EnumName EnumName##_MakeEnumValues[] = {       \
+        ForeachInEnum(EnumName, X_MAKE_ENUM_VALUE)                  \
+    };                                                              \
+                                                                    \
+    enum {                                                          \
+        EnumName##_MakeEnumFirst =                                  \
+            (int)make_enum::detail::ToUnderlying(                   \
+                EnumName##_MakeEnumValues[0]),                      \
+        EnumName##_MakeEnumIsSequential =                           \
+            make_enum::detail::IsSequential(                        \
+                EnumName##_MakeEnumValues,                          \
+                0,                                                  \
+                EnumName##_MakeEnumCount)                           \
+    };
+#endif  /*  __cplusplus  */
+
+/**
+ * Internal macro for declaring compile-time constants that describe
+ * the enumeration <c>EnumName</c>.  These are plain enumeration
+ * constants so they can be used from both C and C++: <p>
+ *
+ * <pre>
+ *   EnumName_MakeEnumIndex_ElementName  index of each element
+ *   EnumName_MakeEnumCount              number of elements
+ *   EnumName_MakeEnumBits               bits needed for an index
+ *   EnumName_MakeEnumFirst              value of the first element
+ *   EnumName_MakeEnumIsSequential       1 if the values of the elements
+ *                                       are the value of the first
+ *                                       element plus their index
+ * </pre>
+ *
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_INDEX_DECLARATION(EnumName, ForeachInEnum)        \
+    enum {                                                          \
+        ForeachInEnum(EnumName, X_MAKE_ENUM_INDEX)                  \
+        EnumName##_MakeEnumCount                                    \
+    };                                                              \
+                                                                    \
+    enum {                                                          \
+        EnumName##_MakeEnumBits =                                   \
+            MAKE_ENUM_INDEX_BITS(EnumName##_MakeEnumCount)          \
+    };                                                              \
+                                                                    \
+    MAKE_ENUM_SEQUENCE_DECLARATION(EnumName, ForeachInEnum)
+
+#if !defined(__cplusplus) && !defined(MAKE_ENUM_LEAN)
+/**
+ * Internal macro for the lesser of the integer constant expressions
+ * <c>a</c> and <c>b</c>.
+ *
+ * @param a first integer constant expression
+ * @param b second integer constant expression
+ */
+#define MAKE_ENUM_LESSER(a, b) (((a) < (b)) ? (a) : (b))
+
+/**
+ * Internal X macro for folding the value of the enumeration element
+ * <c>ElementName</c> into the running minimum generated by
+ * <c>MAKE_ENUM_BITMAP_DEFINITION()</c>.  C has no way to fold a
+ * minimum over the elements in a constant expression, so each element
+ * declares two enumeration constants: the first implicitly has the
+ * value of the previous constant plus one, which is the minimum so
+ * far, and the second is the new minimum minus one.  The minimum
+ * minus one is not taken when the minimum is <c>INT_MIN</c>, so the
+ * result is off by one, and the fast paths of
+ * <c>EnumName_IsValid()</c> are not used, instead of overflowing.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_MIN(EnumName,                                   \
+                        ElementName,                                \
+                        ElementValue)                               \
+    EnumName##_MakeEnumMinBefore_##ElementName,                     \
+    EnumName##_MakeEnumMinAfter_##ElementName =                     \
+        MAKE_ENUM_LESSER(EnumName##_MakeEnumMinBefore_##ElementName, \
+                         MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName)) \
+        - (MAKE_ENUM_LESSER(EnumName##_MakeEnumMinBefore_##ElementName, \
+                            MAKE_ENUM_SCOPED_ELEMENT(EnumName,      \
+                                                     ElementName))  \
+           > INT_MIN),
+
+/**
+ * Internal X macro for counting the enumeration elements whose value
+ * is less than <c>Limit</c> past the smallest value.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param Limit number of values past the smallest value
+ */
+#define X_MAKE_ENUM_IS_WITHIN(EnumName,                             \
+                              ElementName,                          \
+                              Limit)                                \
+    + (((unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) \
+        - (unsigned long)EnumName##_MakeEnumMin)                    \
+       < (unsigned long)(Limit))
+
+/**
+ * Internal X macro for counting the enumeration elements whose value
+ * is less than <c>EnumName_MakeEnumCount</c> past the smallest value.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_IS_DENSE(EnumName,                              \
+                             ElementName,                           \
+                             ElementValue)                          \
+    X_MAKE_ENUM_IS_WITHIN(EnumName,                                 \
+                          ElementName,                              \
+                          EnumName##_MakeEnumCount)
+
+/**
+ * Internal X macro for counting the enumeration elements whose value
+ * is less than <c>MAKE_ENUM_BITMAP_BITS</c> past the smallest value.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_IS_COMPACT(EnumName,                            \
+                               ElementName,                         \
+                               ElementValue)                        \
+    X_MAKE_ENUM_IS_WITHIN(EnumName,                                 \
+                          ElementName,                              \
+                          MAKE_ENUM_BITMAP_BITS)
+
+/**
+ * Internal X macro for setting the bit for the enumeration element
+ * <c>ElementName</c> in the bitmap of valid values.  The shift is
+ * reduced modulo <c>MAKE_ENUM_BITMAP_BITS</c> so it is always
+ * defined, but the bitmap is only used if every element fits.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_BITMAP(EnumName,                                \
+                           ElementName,                             \
+                           ElementValue)                            \
+    | (1UL << (((unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName,   \
+                                                        ElementName) \
+                - (unsigned long)EnumName##_MakeEnumMin)            \
+               % MAKE_ENUM_BITMAP_BITS))
+
+/**
+ * C version of internal macro for defining the constants used by the
+ * fast paths of <c>EnumName_IsValid()</c>: <p>
+ *
+ * <pre>
+ *   EnumName_MakeEnumMin         smallest value of any element
+ *   EnumName_MakeEnumIsDense     1 if every value from the smallest
+ *                                to the largest is an element, in
+ *                                any order
+ *   EnumName_MakeEnumIsCompact   1 if the value of every element is
+ *                                less than MAKE_ENUM_BITMAP_BITS past
+ *                                the smallest value
+ *   EnumName_MakeEnumBitmap      bit i is set if the smallest value
+ *                                plus i is the value of an element
+ * </pre>
+ *
+ * The values of the elements are distinct because
+ * <c>EnumName_MakeEnumIndexOf()</c> has a <c>case</c> for each of
+ * them, so they are dense exactly when all
+ * <c>EnumName_MakeEnumCount</c> of them are less than
+ * <c>EnumName_MakeEnumCount</c> past the smallest value.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_BITMAP_DEFINITION(EnumName, ForeachInEnum)        \
+    enum {                                                          \
+        EnumName##_MakeEnumMinStart = INT_MAX - 1,                  \
+        ForeachInEnum(EnumName, X_MAKE_ENUM_MIN)                    \
+        EnumName##_MakeEnumMin                                      \
+    };                                                              \
+                                                                    \
+    enum {                                                          \
+        EnumName##_MakeEnumIsDense =                                \
+            ((0 ForeachInEnum(EnumName, X_MAKE_ENUM_IS_DENSE))      \
+             == EnumName##_MakeEnumCount),                          \
+        EnumName##_MakeEnumIsCompact =                              \
+            ((0 ForeachInEnum(EnumName, X_MAKE_ENUM_IS_COMPACT))    \
+             == EnumName##_MakeEnumCount)                           \
+    };                                                              \
+                                                                    \
+    static const unsigned long EnumName##_MakeEnumBitmap =          \
+        0UL ForeachInEnum(EnumName, X_MAKE_ENUM_BITMAP);
+#elif !defined(__cplusplus)
+/**
+ * C <c>MAKE_ENUM_LEAN</c> version of internal macro for defining
+ * <c>EnumName_MakeEnumMin</c>, <c>EnumName_MakeEnumIsDense</c>,
+ * <c>EnumName_MakeEnumIsCompact</c>, and
+ * <c>EnumName_MakeEnumBitmap</c>.  <c>ForeachInEnum</c> is not
+ * expanded, so only enumerations whose values are sequential in the
+ * order they are declared are known to be dense, and the bitmap is
+ * never used.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in
+ *        enum (not used)
+ */
+#define MAKE_ENUM_BITMAP_DEFINITION(EnumName, ForeachInEnum)        \
+    enum {                                                          \
+        EnumName##_MakeEnumMin = EnumName##_MakeEnumFirst,          \
+        EnumName##_MakeEnumIsDense = EnumName##_MakeEnumIsSequential, \
+        EnumName##_MakeEnumIsCompact = 0                            \
+    };                                                              \
+                                                                    \
+    static const unsigned long EnumName##_MakeEnumBitmap = 0UL;
+#else
+/**
+ * C++ version of internal macro for defining
+ * <c>EnumName_MakeEnumMin</c>, <c>EnumName_MakeEnumIsDense</c>,
+ * <c>EnumName_MakeEnumIsCompact</c>, and
+ * <c>EnumName_MakeEnumBitmap</c>.  The smallest value and whether the
+ * values are dense come from <c>make_enum::EnumTraits<EnumName></c>.
+ * Like <c>MAKE_ENUM_SEQUENCE_DECLARATION()</c>, the others are
+ * computed from the array of values to avoid folding a long sum.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_BITMAP_DEFINITION(EnumName, ForeachInEnum)        \
+    static constexpr EnumName EnumName##_MakeEnumMin =              \
+        EnumName##_MakeEnumInfo<>::min;                             \
+                                                                    \
+    static constexpr bool EnumName##_MakeEnumIsDense =              \
+        EnumName##_MakeEnumInfo<>::is_dense;                        \
+                                                                    \
+    static constexpr bool EnumName##_MakeEnumIsCompact =            \
+        make_enum::detail::IsCompact(EnumName##_MakeEnumValues,     \
+                                     0,                             \
+                                     EnumName##_MakeEnumCount,      \
+                                     EnumName##_MakeEnumMin);       \
+                                                                    \
+    static constexpr unsigned long EnumName##_MakeEnumBitmap =      \
+        make_enum::detail::Bitmap(EnumName##_MakeEnumValues,        \
+                                  0,                                \
+                                  EnumName##_MakeEnumCount,         \
+                                  EnumName##_MakeEnumMin);
+#endif  /*  __cplusplus  */
+
+/**
+ * Internal X macro for adding the enumeration element
+ * <c>ElementName</c> to the table of elements generated by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_TABLE_ENTRY(EnumName,                           \
+                                ElementName,                        \
+                                ElementValue)                       \
+    {                                                               \
+        MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName),            \
+        #ElementName,                                               \
+        sizeof(#ElementName) - 1,                                   \
+        #EnumName "::" #ElementName,                                \
+        sizeof(#EnumName "::" #ElementName) - 1                     \
+    },
+
+/**
+ * Internal X macro for mapping the enumeration element
+ * <c>ElementName</c> to its index inside the <c>switch</c> statement
+ * of <c>EnumName_MakeEnumIndexOf()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_INDEX_OF(EnumName,                              \
+                             ElementName,                           \
+                             ElementValue)                          \
+    case MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName):           \
+        result = EnumName##_MakeEnumIndex_##ElementName;            \
+        break;
+
+#if !defined(__cplusplus) || MAKE_ENUM_CXX_STD < 201402L
+/**
+ * C and C++11 version of internal macro for defining the
+ * <c>EnumName_MakeEnumIndexOf()</c> function that maps an element to
+ * its index in the table of elements or to
+ * <c>EnumName_MakeEnumCount</c> if the element is not valid.  When
+ * the values of the elements are sequential, the index is found by
+ * subtraction; otherwise, it is found by a <c>switch</c> statement
+ * which the compiler lowers to a jump table or a binary search.  A
+ * table indexed by value cannot be built here without expanding
+ * <c>ForeachInEnum</c> once per possible value.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_INDEX_OF_DEFINITION(EnumName, ForeachInEnum)      \
+    MAKE_ENUM_INLINE size_t                                         \
+    EnumName##_MakeEnumIndexOf(enum EnumName e)                     \
+    {                                                               \
+        size_t result = EnumName##_MakeEnumCount;                   \
+        if (EnumName##_MakeEnumIsSequential) {                      \
+            result = (size_t)((unsigned long)e                      \
+                              - (unsigned long)EnumName##_MakeEnumFirst); \
+        } else {                                                    \
+            switch (e) {                                            \
+                ForeachInEnum(EnumName, X_MAKE_ENUM_INDEX_OF)       \
+            default:                                                \
+                break;                                              \
+            }                                                       \
+        }                                                           \
+        return result;                                              \
+    }
+#else
+/**
+ * C++14 version of internal macro for defining the
+ * <c>EnumName_MakeEnumIndexOf()</c> function.  When the values of the
+ * elements are sequential, the index is found by subtraction;
+ * otherwise, it is found in O(1) by
+ * <c>EnumName_MakeEnumValueHash</c>, a perfect hash over the values
+ * of the elements built at compile time, so sparse values such as bit
+ * flags or protocol codes cost the same as dense ones.  The function
+ * is <c>constexpr</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_INDEX_OF_DEFINITION(EnumName, ForeachInEnum)      \
+    static constexpr auto EnumName##_MakeEnumValueHash =            \
+        make_enum::detail::MakeValueHash<                           \
+            EnumName##_MakeEnumIsSequential                         \
+            ? 1                                                     \
+            : (size_t)EnumName##_MakeEnumCount>(                    \
+                EnumName##_MakeEnumEntries);                        \
+                                                                    \
+    static constexpr size_t                                         \
+    EnumName##_MakeEnumIndexOf(enum EnumName e)                     \
+    {                                                               \
+        return (EnumName##_MakeEnumIsSequential                     \
+                ? (size_t)((unsigned long)e                         \
+                           - (unsigned long)EnumName##_MakeEnumFirst) \
+                : EnumName##_MakeEnumValueHash.Find(                \
+                    EnumName##_MakeEnumEntries,                     \
+                    e));                                            \
+    }
+#endif  /*  !__cplusplus || MAKE_ENUM_CXX_STD < 201402L  */
+
+#ifdef MAKE_ENUM_INSTRUMENTED
+/**
+ * Internal macro for defining the usage counters of the enumeration
+ * <c>EnumName</c>.  There is one set of counters per element, in the
+ * same order as the table of elements, followed by the counters of
+ * the failures that are not attributed to any element.  They have
+ * static storage duration so they start at zero.
+ *
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_USAGE_COUNTERS_DEFINITION(EnumName)                   \
+    static struct EnumName##_MakeEnumUsageCounters {                    \
+        struct MakeEnum_ElementCounters elements[EnumName##_MakeEnumCount]; \
+        struct MakeEnum_Counter from_string_misses;                     \
+        struct MakeEnum_Counter is_valid_failures;                      \
+    } EnumName##_MakeEnumUsageCounters;
+#else
+/**
+ * Internal macro that defines nothing because
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is not defined.
+ *
+ * @param EnumName enumeration name (not used)
+ */
+#define MAKE_ENUM_USAGE_COUNTERS_DEFINITION(EnumName)
+#endif  /*  MAKE_ENUM_INSTRUMENTED  */
+
+/**
+ * Internal macro for defining the static table of elements for the
+ * enumeration <c>EnumName</c> along with the
+ * <c>EnumName_MakeEnumIndexOf()</c> function generated by
+ * <c>MAKE_ENUM_INDEX_OF_DEFINITION()</c> that maps an element to its
+ * index in the table or to <c>EnumName_MakeEnumCount</c> if the
+ * element is not valid.  Each entry holds the value of the element
+ * along with its unscoped and scoped names and their lengths.  The
+ * usage counters, if any, are defined here too so every helper
+ * function can update them.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)         \
+    struct EnumName##_MakeEnumEntry {                               \
+        enum EnumName value;                                        \
+        const char* name;                                           \
+        size_t name_length;                                         \
+        const char* qualified_name;                                 \
+        size_t qualified_name_length;                               \
+    };                                                              \
+                                                                    \
+    static MAKE_ENUM_TABLE_CONST struct EnumName##_MakeEnumEntry    \
+    EnumName##_MakeEnumEntries[] = {                                \
+        ForeachInEnum(EnumName, X_MAKE_ENUM_TABLE_ENTRY)            \
+    };                                                              \
+                                                                    \
+    MAKE_ENUM_INDEX_OF_DEFINITION(EnumName, ForeachInEnum)          \
+    MAKE_ENUM_USAGE_COUNTERS_DEFINITION(EnumName)
+
+#ifdef __cplusplus
+namespace make_enum {
+namespace detail {
+
+/**
+ * Insert the name of an element into <c>ostrm</c> for
+ * <c>operator<<()</c>.  If no field width is set, which is the usual
+ * case, the name is written by a single call to <c>write()</c> using
+ * its known length.  Otherwise, it is inserted as a null terminated
+ * string so the width, fill, and adjustment are honored the same as
+ * for any other string.  Nothing is allocated either way.
+ *
+ * @param ostrm output stream
+ * @param name null terminated name of the element
+ * @param length length of <c>name</c>
+ */
+inline std::ostream&
+WriteName(std::ostream& ostrm,
+          const char* name,
+          size_t length)
+{
+    if (ostrm.width() == 0) {
+        ostrm.write(name, (std::streamsize)length);
+    } else {
+        ostrm << name;
+    }
+    return ostrm;
+}
+
+/**
+ * Returns the larger of <c>a</c> and <c>b</c>.
+ */
+constexpr size_t
+Max(size_t a,
+    size_t b)
+{
+    return (a > b) ? a : b;
+}
+
+/**
+ * Returns the length of the longest scoped name of the entries from
+ * <c>begin</c> up to but not including <c>end</c> in a table of
+ * elements generated by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  The
+ * scoped name of an element is always longer than its unscoped
+ * name.  The range is split in half at each step so the depth of the
+ * recursion is only logarithmic in the number of elements.
+ *
+ * @param entries table of elements
+ * @param begin index of the first entry
+ * @param end index one past the last entry
+ */
+template <typename Entry>
+constexpr size_t
+MaxNameLength(const Entry* entries,
+              size_t begin,
+              size_t end)
+{
+    return ((end - begin == 1)
+            ? entries[begin].qualified_name_length
+            : Max(MaxNameLength(entries, begin, begin + (end - begin) / 2),
+                  MaxNameLength(entries, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns the value of the enumeration element <c>e</c> as its
+ * underlying integral type.
+ */
+template <typename E>
+constexpr typename std::underlying_type<E>::type
+ToUnderlying(E e)
+{
+    return static_cast<typename std::underlying_type<E>::type>(e);
+}
+
+/**
+ * Returns true if the value of each of the enumeration elements from
+ * <c>begin</c> up to but not including <c>end</c> in <c>values</c> is
+ * the value of <c>values[0]</c> plus its index.  The range is split
+ * in half at each step so the depth of the recursion is only
+ * logarithmic in the number of elements.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ */
+template <typename E>
+constexpr bool
+IsSequential(const E* values,
+             size_t begin,
+             size_t end)
+{
+    return ((end - begin == 1)
+            ? ((unsigned long long)ToUnderlying(values[begin])
+               - (unsigned long long)ToUnderlying(values[0])
+               == (unsigned long long)begin)
+            : (IsSequential(values, begin, begin + (end - begin) / 2)
+               && IsSequential(values, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns the value of the enumeration element <c>e</c> minus the
+ * value of the enumeration element <c>first</c> using unsigned
+ * arithmetic so it cannot overflow.
+ */
+template <typename E>
+constexpr unsigned long long
+Offset(E e,
+       E first)
+{
+    return ((unsigned long long)ToUnderlying(e)
+            - (unsigned long long)ToUnderlying(first));
+}
+
+/**
+ * Returns true if the value of each of the enumeration elements from
+ * <c>begin</c> up to but not including <c>end</c> in <c>values</c> is
+ * less than <c>MAKE_ENUM_BITMAP_BITS</c> past the value of
+ * <c>min</c>.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ * @param min element with the smallest value
+ */
+template <typename E>
+constexpr bool
+IsCompact(const E* values,
+          size_t begin,
+          size_t end,
+          E min)
+{
+    return ((end - begin == 1)
+            ? (Offset(values[begin], min) < MAKE_ENUM_BITMAP_BITS)
+            : (IsCompact(values, begin, begin + (end - begin) / 2, min)
+               && IsCompact(values, begin + (end - begin) / 2, end, min)));
+}
+
+/**
+ * Returns the bitmap that has bit <c>i</c> set if the value of
+ * <c>min</c> plus <c>i</c> is the value of one of the enumeration
+ * elements from <c>begin</c> up to but not including <c>end</c> in
+ * <c>values</c>.  The bitmap is only meaningful if
+ * <c>IsCompact()</c> is true for the same range.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ * @param min element with the smallest value
+ */
+template <typename E>
+constexpr unsigned long
+Bitmap(const E* values,
+       size_t begin,
+       size_t end,
+       E min)
+{
+    return ((end - begin == 1)
+            ? (1UL << (Offset(values[begin], min)
+                       % MAKE_ENUM_BITMAP_BITS))
+            : (Bitmap(values, begin, begin + (end - begin) / 2, min)
+               | Bitmap(values, begin + (end - begin) / 2, end, min)));
+}
+
+/**
+ * Returns the bitwise OR of the values of the enumeration elements
+ * from <c>begin</c> up to but not including <c>end</c> in
+ * <c>values</c>.  This is the mask of every bit used by a flag
+ * enumeration.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ */
+template <typename E>
+constexpr unsigned long
+Mask(const E* values,
+     size_t begin,
+     size_t end)
+{
+    return ((end - begin == 1)
+            ? (unsigned long)ToUnderlying(values[begin])
+            : (Mask(values, begin, begin + (end - begin) / 2)
+               | Mask(values, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns the bitwise OR of the values of the enumeration elements
+ * from <c>begin</c> up to but not including <c>end</c> in
+ * <c>values</c> that have more than one bit set.  These are the bits
+ * that <c>EnumName_FlagsToString()</c> must try to match with a
+ * single element before it visits each bit on its own.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ */
+template <typename E>
+constexpr unsigned long
+MultiBitMask(const E* values,
+             size_t begin,
+             size_t end)
+{
+    return ((end - begin == 1)
+            ? ((((unsigned long)ToUnderlying(values[begin])
+                 & ((unsigned long)ToUnderlying(values[begin]) - 1UL)) != 0)
+               ? (unsigned long)ToUnderlying(values[begin])
+               : 0UL)
+            : (MultiBitMask(values, begin, begin + (end - begin) / 2)
+               | MultiBitMask(values, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns whichever of the enumeration elements <c>a</c> and
+ * <c>b</c> has the smaller value.
+ */
+template <typename E>
+constexpr E
+Lesser(E a,
+       E b)
+{
+    return (ToUnderlying(b) < ToUnderlying(a)) ? b : a;
+}
+
+/**
+ * Returns whichever of the enumeration elements <c>a</c> and
+ * <c>b</c> has the larger value.
+ */
+template <typename E>
+constexpr E
+Greater(E a,
+        E b)
+{
+    return (ToUnderlying(b) > ToUnderlying(a)) ? b : a;
+}
+
+/**
+ * Returns the smallest of the enumeration elements from
+ * <c>begin</c> up to but not including <c>end</c> in
+ * <c>values</c>.  The range is split in half at each step so the
+ * depth of the recursion is only logarithmic in the number of
+ * elements.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ */
+template <typename E>
+constexpr E
+MinValue(const E* values,
+         size_t begin,
+         size_t end)
+{
+    return ((end - begin == 1)
+            ? values[begin]
+            : Lesser(MinValue(values, begin, begin + (end - begin) / 2),
+                     MinValue(values, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns the largest of the enumeration elements from <c>begin</c>
+ * up to but not including <c>end</c> in <c>values</c>.
+ *
+ * @param values array of enumeration elements
+ * @param begin index of the first element
+ * @param end index one past the last element
+ */
+template <typename E>
+constexpr E
+MaxValue(const E* values,
+         size_t begin,
+         size_t end)
+{
+    return ((end - begin == 1)
+            ? values[begin]
+            : Greater(MaxValue(values, begin, begin + (end - begin) / 2),
+                      MaxValue(values, begin + (end - begin) / 2, end)));
+}
+
+/**
+ * Returns the number of bits that are set in <c>x</c>.
+ */
+inline size_t
+PopCount(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_popcountll(x);
+#else
+    size_t result = 0;
+    for (; x != 0; x &= x - 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+/**
+ * Returns the index of the lowest bit that is set in <c>x</c> which
+ * must not be zero.
+ */
+inline size_t
+CountTrailingZeros(uint64_t x)
+{
+#if defined(__GNUC__)
+    return (size_t)__builtin_ctzll(x);
+#else
+    size_t result = 0;
+    for (; (x & 1) == 0; x >>= 1) {
+        ++result;
+    }
+    return result;
+#endif
+}
+
+#if MAKE_ENUM_CXX_STD >= 201402L
+/**
+ * Returns the schema hash of the <c>count</c> elements with the
+ * names <c>names</c> and the values <c>values</c> in order.  It gives
+ * the same result as the <c>EnumName_SchemaHash()</c> that C and
+ * C++11 compute from the table of elements at run time.
+ *
+ * @param names null-terminated names of the elements
+ * @param values values of the elements
+ * @param count number of elements
+ */
+template <typename E>
+constexpr MakeEnum_Uint64
+SchemaHash(const char* const* names,
+           const E* values,
+           size_t count)
+{
+    MakeEnum_Uint64 h = MAKE_ENUM_SCHEMA_HASH_BASIS;
+    for (size_t i = 0; i < count; ++i) {
+        h = MakeEnum_SchemaHashStep(h,
+                                    names[i],
+                                    (MakeEnum_Uint64)ToUnderlying(values[i]));
+    }
+    return h;
+}
+
+/**
+ * Hash the <c>n</c> bytes starting at <c>s</c>.  This is 64-bit
+ * FNV-1a followed by the MurmurHash3 finalizer so every bit of the
+ * result depends on every byte of the input and on the seed.  If
+ * <c>fold</c> is true, ASCII case is ignored.
+ *
+ * @param s bytes to hash
+ * @param n number of bytes to hash
+ * @param seed seed that selects the hash function
+ * @param fold whether to ignore ASCII case
+ */
+constexpr uint64_t
+Hash(const char* s,
+     size_t n,
+     uint64_t seed,
+     bool fold = false)
+{
+    uint64_t h = 14695981039346656037ull ^ seed;
+    for (size_t i = 0; i < n; ++i) {
+        h ^= (unsigned char)(fold ? MAKE_ENUM_FOLD_CASE(s[i]) : s[i]);
+        h *= 1099511628211ull;
+    }
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Returns the smallest power of two that is greater than or equal to
+ * <c>n</c>.
+ */
+constexpr size_t
+NextPowerOfTwo(size_t n)
+{
+    size_t result = 1;
+    while (result < n) {
+        result <<= 1;
+    }
+    return result;
+}
+
+/**
+ * Returns true if the <c>n</c> bytes starting at <c>a</c> are the
+ * same as the <c>n</c> bytes starting at <c>b</c>.  If <c>fold</c> is
+ * true, ASCII case is ignored.
+ */
+constexpr bool
+Equal(const char* a,
+      const char* b,
+      size_t n,
+      bool fold)
+{
+    for (size_t i = 0; i < n; ++i) {
+        if ((fold ? MAKE_ENUM_FOLD_CASE(a[i]) : a[i])
+            != (fold ? MAKE_ENUM_FOLD_CASE(b[i]) : b[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns the name that is key <c>k</c> of a perfect hash with
+ * <c>Stride</c> keys per entry.  The first key of each entry is its
+ * unscoped name, and the second, if any, is its scoped name.
+ */
+template <size_t Stride, typename Entry>
+constexpr const char*
+KeyName(const Entry& entry,
+        size_t k)
+{
+    return (k % Stride == 0) ? entry.name : entry.qualified_name;
+}
+
+/**
+ * Returns the length of the name returned by <c>KeyName()</c>.
+ */
+template <size_t Stride, typename Entry>
+constexpr size_t
+KeyLength(const Entry& entry,
+          size_t k)
+{
+    return (k % Stride == 0) ? entry.name_length : entry.qualified_name_length;
+}
+
+/**
+ * Perfect hash over the <c>K</c> keys of a table of elements
+ * generated by <c>MAKE_ENUM_TABLE_DEFINITION()</c> where key
+ * <c>Stride*i</c> is the unscoped name of element <c>i</c> and, if
+ * <c>Stride</c> is 2, key <c>2*i+1</c> is its scoped name.  If
+ * <c>Fold</c> is true, keys are hashed and compared ignoring ASCII
+ * case, and keys that differ only by case are stored once.  The
+ * table is built at compile time by <c>MakePerfectHash()</c> using
+ * the "hash and displace" technique:  keys are first distributed
+ * into buckets, and then each bucket, largest first, is assigned the
+ * displacement that moves all of its keys into empty slots.  Because
+ * no two keys share a slot, a lookup is one hash, two loads, and one
+ * verifying compare.
+ *
+ * @tparam K number of keys
+ * @tparam Stride number of keys per entry (1 or 2)
+ * @tparam Fold whether to ignore ASCII case
+ */
+template <size_t K, size_t Stride = 2, bool Fold = false>
+struct PerfectHash {
+
+    /** Number of slots.  Keeping the load at or below 1/2 lets
+        the builder place each bucket after a handful of tries. */
+    static constexpr size_t kSlots = NextPowerOfTwo(2 * K);
+
+    /** Number of buckets.  An average of four keys per bucket
+        keeps the displacement table small. */
+    static constexpr size_t kBuckets = (K + 3) / 4;
+
+    /** Seed passed to <c>Hash()</c>. */
+    uint64_t seed;
+
+    /** Displacement for each bucket. */
+    uint32_t displacements[kBuckets];
+
+    /** One plus the key in each slot, or zero if the slot is empty. */
+    uint32_t slots[kSlots];
+
+    /** Returns the bucket for the hash <c>h</c>. */
+    static constexpr size_t
+    Bucket(uint64_t h)
+    {
+        return (size_t)((h >> 40) % kBuckets);
+    }
+
+    /** Returns the slot for the hash <c>h</c> given the displacement
+        <c>d</c> of its bucket.  The step is odd so every slot is
+        reachable as <c>d</c> varies. */
+    static constexpr size_t
+    Slot(uint64_t h,
+         uint32_t d)
+    {
+        return (size_t)(((uint32_t)h + d * ((uint32_t)(h >> 32) | 1u))
+                        & (kSlots - 1));
+    }
+
+    /**
+     * Returns the entry of <c>entries</c> that has a name that is a
+     * key equal to the <c>n</c> bytes starting at <c>s</c> or
+     * <c>nullptr</c> if there is no such entry.
+     */
+    template <typename Entry>
+    const Entry*
+    Find(const Entry* entries,
+         const char* s,
+         size_t n) const
+    {
+        uint64_t h = Hash(s, n, seed, Fold);
+        uint32_t key = slots[Slot(h, displacements[Bucket(h)])];
+        if (key == 0) {
+            return nullptr;
+        }
+        const Entry* entry = &entries[(key - 1) / Stride];
+        if ((KeyLength<Stride>(*entry, key - 1) != n) ||
+            (Fold
+             ? !MakeEnum_EqualIgnoreCase(KeyName<Stride>(*entry, key - 1), s, n)
+             : (memcmp(KeyName<Stride>(*entry, key - 1), s, n) != 0)))
+        {
+            return nullptr;
+        }
+        return entry;
+    }
+};
+
+template <size_t K, size_t Stride, bool Fold>
+constexpr size_t PerfectHash<K, Stride, Fold>::kSlots;
+
+template <size_t K, size_t Stride, bool Fold>
+constexpr size_t PerfectHash<K, Stride, Fold>::kBuckets;
+
+/**
+ * Place the keys of each bucket of the perfect hash <c>table</c>,
+ * largest bucket first, by assigning the bucket the first
+ * displacement that moves all of its keys into empty slots.  Returns
+ * false if some bucket cannot be placed, in which case a different
+ * seed should be tried.
+ *
+ * @param table perfect hash being built
+ * @param hashes hash of each key
+ * @param bucket_sizes number of keys in each bucket
+ * @param bucket_starts where each bucket starts in <c>bucket_keys</c>
+ * @param bucket_keys keys grouped by bucket
+ * @param max_bucket_size number of keys in the largest bucket
+ */
+template <typename Table>
+constexpr bool
+PlaceBuckets(Table& table,
+             const uint64_t* hashes,
+             const size_t* bucket_sizes,
+             const size_t* bucket_starts,
+             const size_t* bucket_keys,
+             size_t max_bucket_size)
+{
+    bool ok = true;
+    for (size_t size = max_bucket_size; ok && size > 0; --size) {
+        for (size_t b = 0; ok && b < Table::kBuckets; ++b) {
+            if (bucket_sizes[b] != size) {
+                continue;
+            }
+            const size_t* keys = &bucket_keys[bucket_starts[b]];
+            bool placed = false;
+            for (uint32_t d = 0; !placed && d < Table::kSlots; ++d) {
+                placed = true;
+                for (size_t i = 0; placed && i < size; ++i) {
+                    size_t slot = Table::Slot(hashes[keys[i]], d);
+                    if (table.slots[slot] != 0) {
+                        placed = false;
+                    }
+                    for (size_t j = 0; placed && j < i; ++j) {
+                        size_t other = Table::Slot(hashes[keys[j]], d);
+                        if (other == slot) {
+                            placed = false;
+                        }
+                    }
+                }
+                if (placed) {
+                    table.displacements[b] = d;
+                    for (size_t i = 0; i < size; ++i) {
+                        size_t k = keys[i];
+                        table.slots[Table::Slot(hashes[k], d)] =
+                            (uint32_t)(k + 1);
+                    }
+                }
+            }
+            ok = placed;
+        }
+    }
+    return ok;
+}
+
+/**
+ * Build the perfect hash over the names of the <c>K/Stride</c>
+ * elements in <c>entries</c>.  Seeds are tried in order until one
+ * yields a hash that places every bucket.  Keys that are equal to an
+ * earlier key in the same bucket, which can only happen when
+ * <c>Fold</c> is true, are dropped so the earlier key wins.
+ *
+ * @tparam K number of keys
+ * @tparam Stride number of keys per entry (1 or 2)
+ * @tparam Fold whether to ignore ASCII case
+ * @param entries table of elements
+ */
+template <size_t K, size_t Stride = 2, bool Fold = false, typename Entry>
+constexpr PerfectHash<K, Stride, Fold>
+MakePerfectHash(const Entry* entries)
+{
+    using Table = PerfectHash<K, Stride, Fold>;
+    for (uint64_t seed = 0; ; ++seed) {
+        Table table{};
+        uint64_t hashes[K] = {};
+        size_t bucket_sizes[Table::kBuckets] = {};
+        size_t bucket_starts[Table::kBuckets + 1] = {};
+        size_t bucket_keys[K] = {};
+        size_t max_bucket_size = 0;
+
+        table.seed = seed;
+
+        // Hash each key and distribute the keys into buckets.
+        for (size_t k = 0; k < K; ++k) {
+            const Entry& entry = entries[k / Stride];
+            hashes[k] = Hash(KeyName<Stride>(entry, k),
+                             KeyLength<Stride>(entry, k),
+                             seed,
+                             Fold);
+            ++bucket_sizes[Table::Bucket(hashes[k])];
+        }
+        for (size_t b = 0; b < Table::kBuckets; ++b) {
+            bucket_starts[b + 1] = bucket_starts[b] + bucket_sizes[b];
+            bucket_sizes[b] = 0;
+        }
+        for (size_t k = 0; k < K; ++k) {
+            size_t b = Table::Bucket(hashes[k]);
+            bool duplicate = false;
+            for (size_t i = 0; !duplicate && i < bucket_sizes[b]; ++i) {
+                size_t other = bucket_keys[bucket_starts[b] + i];
+                duplicate =
+                    ((hashes[other] == hashes[k]) &&
+                     (KeyLength<Stride>(entries[other / Stride], other)
+                      == KeyLength<Stride>(entries[k / Stride], k)) &&
+                     Equal(KeyName<Stride>(entries[other / Stride], other),
+                           KeyName<Stride>(entries[k / Stride], k),
+                           KeyLength<Stride>(entries[k / Stride], k),
+                           Fold));
+            }
+            if (!duplicate) {
+                bucket_keys[bucket_starts[b] + bucket_sizes[b]++] = k;
+            }
+        }
+        for (size_t b = 0; b < Table::kBuckets; ++b) {
+            if (bucket_sizes[b] > max_bucket_size) {
+                max_bucket_size = bucket_sizes[b];
+            }
+        }
+
+        // Place the buckets largest first.
+        if (PlaceBuckets(table,
+                         hashes,
+                         bucket_sizes,
+                         bucket_starts,
+                         bucket_keys,
+                         max_bucket_size))
+        {
+            return table;
+        }
+    }
+}
+
+/**
+ * Hash the value <c>v</c> of an enumeration element using the
+ * MurmurHash3 finalizer so every bit of the result depends on every
+ * bit of the input and on the seed.
+ *
+ * @param v value to hash
+ * @param seed seed that selects the hash function
+ */
+constexpr uint64_t
+HashValue(uint64_t v,
+          uint64_t seed)
+{
+    uint64_t h = v ^ (seed * 0x9e3779b97f4a7c15ull);
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdull;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ull;
+    h ^= h >> 33;
+    return h;
+}
+
+/**
+ * Perfect hash over the values of the <c>K</c> elements of a table of
+ * elements generated by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  It is
+ * built at compile time by <c>MakeValueHash()</c> the same way as
+ * <c>PerfectHash</c>, and it maps the value of an element to the
+ * index of the element in the table in O(1) no matter how sparse the
+ * values are.
+ *
+ * @tparam K number of elements
+ */
+template <size_t K>
+struct ValueHash {
+
+    /** Number of slots. */
+    static constexpr size_t kSlots = NextPowerOfTwo(2 * K);
+
+    /** Number of buckets. */
+    static constexpr size_t kBuckets = (K + 3) / 4;
+
+    /** Seed passed to <c>HashValue()</c>. */
+    uint64_t seed;
+
+    /** Displacement for each bucket. */
+    uint32_t displacements[kBuckets];
+
+    /** One plus the index of the element in each slot, or zero if
+        the slot is empty. */
+    uint32_t slots[kSlots];
+
+    /** Returns the bucket for the hash <c>h</c>. */
+    static constexpr size_t
+    Bucket(uint64_t h)
+    {
+        return (size_t)((h >> 40) % kBuckets);
+    }
+
+    /** Returns the slot for the hash <c>h</c> given the displacement
+        <c>d</c> of its bucket. */
+    static constexpr size_t
+    Slot(uint64_t h,
+         uint32_t d)
+    {
+        return (size_t)(((uint32_t)h + d * ((uint32_t)(h >> 32) | 1u))
+                        & (kSlots - 1));
+    }
+
+    /**
+     * Returns the index of the entry of <c>entries</c> whose value is
+     * <c>e</c> or <c>K</c> if there is no such entry.
+     */
+    template <typename Entry, typename E>
+    constexpr size_t
+    Find(const Entry* entries,
+         E e) const
+    {
+        uint64_t h = HashValue((uint64_t)ToUnderlying(e), seed);
+        uint32_t key = slots[Slot(h, displacements[Bucket(h)])];
+        return ((key != 0) && (entries[key - 1].value == e)) ? key - 1 : K;
+    }
+};
+
+template <size_t K>
+constexpr size_t ValueHash<K>::kSlots;
+
+template <size_t K>
+constexpr size_t ValueHash<K>::kBuckets;
+
+/**
+ * Build the perfect hash over the values of the <c>K</c> elements in
+ * <c>entries</c>.  Seeds are tried in order until one yields a hash
+ * that places every bucket.  The values must be distinct which they
+ * are because they are also the labels of a <c>switch</c> statement.
+ *
+ * @tparam K number of elements
+ * @param entries table of elements
+ */
+template <size_t K, typename Entry>
+constexpr ValueHash<K>
+MakeValueHash(const Entry* entries)
+{
+    using Table = ValueHash<K>;
+    for (uint64_t seed = 0; ; ++seed) {
+        Table table{};
+        uint64_t hashes[K] = {};
+        size_t bucket_sizes[Table::kBuckets] = {};
+        size_t bucket_starts[Table::kBuckets + 1] = {};
+        size_t bucket_keys[K] = {};
+        size_t max_bucket_size = 0;
+
+        table.seed = seed;
+
+        // Hash each value and distribute the values into buckets.
+        for (size_t k = 0; k < K; ++k) {
+            hashes[k] = HashValue((uint64_t)ToUnderlying(entries[k].value),
+                                  seed);
+            ++bucket_sizes[Table::Bucket(hashes[k])];
+        }
+        for (size_t b = 0; b < Table::kBuckets; ++b) {
+            bucket_starts[b + 1] = bucket_starts[b] + bucket_sizes[b];
+            if (bucket_sizes[b] > max_bucket_size) {
+                max_bucket_size = bucket_sizes[b];
+            }
+            bucket_sizes[b] = 0;
+        }
+        for (size_t k = 0; k < K; ++k) {
+            size_t b = Table::Bucket(hashes[k]);
+            bucket_keys[bucket_starts[b] + bucket_sizes[b]++] = k;
+        }
+
+        // Place the buckets largest first.
+        if (PlaceBuckets(table,
+                         hashes,
+                         bucket_sizes,
+                         bucket_starts,
+                         bucket_keys,
+                         max_bucket_size))
+        {
+            return table;
+        }
+    }
+}
+
+/**
+ * Returns the byte <c>c</c> as an <c>unsigned char</c> so bytes order
+ * the same way they do for <c>memcmp()</c>.  If <c>fold</c> is true,
+ * ASCII case is ignored.
+ */
+constexpr unsigned char
+Byte(char c,
+     bool fold)
+{
+    return (unsigned char)(fold ? MAKE_ENUM_FOLD_CASE(c) : c);
+}
+
+/**
+ * Returns the first eight of the <c>n</c> bytes starting at <c>s</c>
+ * packed into an integer with the first byte in the most significant
+ * position and zero in place of missing bytes.  Comparing the
+ * prefixes of two names orders them the same way as comparing their
+ * first eight bytes with <c>memcmp()</c>.  If <c>fold</c> is true,
+ * ASCII case is ignored.
+ *
+ * @param s bytes to pack
+ * @param n number of bytes starting at <c>s</c>
+ * @param fold whether to ignore ASCII case
+ */
+constexpr uint64_t
+Prefix(const char* s,
+       size_t n,
+       bool fold = false)
+{
+    uint64_t result = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        result = (result << 8) | ((i < n) ? Byte(s[i], fold) : 0u);
+    }
+    return result;
+}
+
+/**
+ * Returns a negative number, zero, or a positive number as the name
+ * <c>a</c> with the prefix <c>ap</c> and length <c>an</c> orders
+ * before, the same as, or after the name <c>b</c> with the prefix
+ * <c>bp</c> and length <c>bn</c>.  Names order by their prefixes,
+ * then by their lengths, and then by the bytes after the prefixes.
+ * If <c>fold</c> is true, ASCII case is ignored.
+ */
+constexpr int
+Compare(uint64_t ap,
+        const char* a,
+        size_t an,
+        uint64_t bp,
+        const char* b,
+        size_t bn,
+        bool fold = false)
+{
+    if (ap != bp) {
+        return (ap < bp) ? -1 : 1;
+    }
+    if (an != bn) {
+        return (an < bn) ? -1 : 1;
+    }
+    for (size_t i = 8; i < an; ++i) {
+        if (Byte(a[i], fold) != Byte(b[i], fold)) {
+            return (Byte(a[i], fold) < Byte(b[i], fold)) ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+/**
+ * The <c>K</c> entries of a table of elements generated by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c> sorted by <c>Compare()</c> of
+ * their unscoped names.  If <c>Fold</c> is true, the names are
+ * sorted and compared ignoring ASCII case.  The table is built at
+ * compile time by <c>MakeSortedNames()</c>.  The prefixes of the
+ * names are kept in their own array, so a lookup is a binary search
+ * that compares one integer per step and only compares the rest of a
+ * name after its prefix and length match.
+ *
+ * @tparam K number of entries
+ * @tparam Fold whether to ignore ASCII case
+ */
+template <size_t K, bool Fold = false>
+struct SortedNames {
+
+    /** <c>Prefix()</c> of the name of each entry in sorted order. */
+    uint64_t prefixes[K];
+
+    /** Indexes of the entries in sorted order. */
+    uint32_t indexes[K];
+
+    /**
+     * Returns a negative number, zero, or a positive number as the
+     * name of the <c>k</c>th entry in sorted order orders before, the
+     * same as, or after the <c>n</c> bytes starting at <c>s</c> whose
+     * <c>Prefix()</c> is <c>prefix</c>.
+     */
+    template <typename Entry>
+    int
+    Order(const Entry* entries,
+          size_t k,
+          uint64_t prefix,
+          const char* s,
+          size_t n) const
+    {
+        const Entry& entry = entries[indexes[k]];
+        if (prefixes[k] != prefix) {
+            return (prefixes[k] < prefix) ? -1 : 1;
+        }
+        if (entry.name_length != n) {
+            return (entry.name_length < n) ? -1 : 1;
+        }
+        if (!Fold) {
+            return (n > 8) ? memcmp(entry.name + 8, s + 8, n - 8) : 0;
+        }
+        for (size_t i = 8; i < n; ++i) {
+            if (Byte(entry.name[i], Fold) != Byte(s[i], Fold)) {
+                return (Byte(entry.name[i], Fold) < Byte(s[i], Fold)) ? -1 : 1;
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * Returns the entry of <c>entries</c> that has an unscoped name
+     * equal to the <c>n</c> bytes starting at <c>s</c> or
+     * <c>nullptr</c> if there is no such entry.  If several names are
+     * equal when case is ignored, the one declared first is returned.
+     */
+    template <typename Entry>
+    const Entry*
+    Find(const Entry* entries,
+         const char* s,
+         size_t n) const
+    {
+        uint64_t prefix = Prefix(s, n, Fold);
+        size_t lo = 0;
+        size_t hi = K;
+        while (lo < hi) {
+            size_t mid = lo + (hi - lo) / 2;
+            if (Order(entries, mid, prefix, s, n) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if ((lo == K) || (Order(entries, lo, prefix, s, n) != 0)) {
+            return nullptr;
+        }
+        return &entries[indexes[lo]];
+    }
+};
+
+/**
+ * Returns the <c>SortedNames</c> for the <c>K</c> entries of a table
+ * of elements generated by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  The
+ * entries are sorted by a stable bottom-up merge sort so building the
+ * table takes O(K log K) compares no matter how the elements are
+ * declared, and names that are equal when case is ignored stay in
+ * the order they are declared.
+ *
+ * @tparam K number of entries
+ * @tparam Fold whether to ignore ASCII case
+ * @param entries table of elements
+ */
+template <size_t K, bool Fold = false, typename Entry>
+constexpr SortedNames<K, Fold>
+MakeSortedNames(const Entry* entries)
+{
+    SortedNames<K, Fold> table{};
+    uint64_t prefixes[K] = {};
+    uint32_t merged[K] = {};
+    for (size_t k = 0; k < K; ++k) {
+        prefixes[k] = Prefix(entries[k].name, entries[k].name_length, Fold);
+        table.indexes[k] = (uint32_t)k;
+    }
+    for (size_t width = 1; width < K; width *= 2) {
+        for (size_t lo = 0; lo < K; lo += 2 * width) {
+            size_t mid = (lo + width < K) ? lo + width : K;
+            size_t hi = (lo + 2 * width < K) ? lo + 2 * width : K;
+            size_t i = lo;
+            size_t j = mid;
+            for (size_t k = lo; k < hi; ++k) {
+                if ((j == hi) ||
+                    ((i < mid) &&
+                     (Compare(prefixes[table.indexes[i]],
+                              entries[table.indexes[i]].name,
+                              entries[table.indexes[i]].name_length,
+                              prefixes[table.indexes[j]],
+                              entries[table.indexes[j]].name,
+                              entries[table.indexes[j]].name_length,
+                              Fold)
+                      <= 0)))
+                {
+                    merged[k] = table.indexes[i++];
+                } else {
+                    merged[k] = table.indexes[j++];
+                }
+            }
+        }
+        for (size_t k = 0; k < K; ++k) {
+            table.indexes[k] = merged[k];
+        }
+    }
+    for (size_t k = 0; k < K; ++k) {
+        table.prefixes[k] = prefixes[table.indexes[k]];
+    }
+    return table;
+}
+#endif  /*  MAKE_ENUM_CXX_STD >= 201402L  */
+
+}  /*  namespace detail  */
+
+/**
+ * Compile-time description of an enumeration declared by
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.  It has the following static
+ * constexpr members: <p>
+ *
+ * <pre>
+ *   count      number of elements
+ *   values[]   elements in the order they were declared
+ *   names[]    unscoped names of the elements in the same order
+ *   min        element with the smallest value
+ *   max        element with the largest value
+ *   is_dense   true if every value from min to max is an element
+ * </pre>
+ *
+ * The members are found through the <c>MakeEnumTraits()</c> function
+ * declared alongside the enumeration so this works no matter which
+ * namespace the enumeration is declared in.
+ *
+ * @param E enumeration type
+ */
+template <typename E>
+struct EnumTraits : decltype(MakeEnumTraits(E()))
+{
+};
+
+/**
+ * Map from each element of the enumeration <c>E</c> to a value of
+ * type <c>T</c> that is stored in a flat array indexed by
+ * <c>ToIndex()</c>, so lookups do not hash or allocate no matter how
+ * sparse the values of the elements are.  It is an aggregate, so
+ * <c>EnumMap<E, T> m = {}</c> value-initializes every entry.  Using an
+ * element that is not valid with <c>operator[]</c> is undefined; use
+ * <c>Find()</c> if the element might not be valid.
+ *
+ * @param E enumeration type
+ * @param T mapped type
+ */
+template <typename E, typename T>
+struct EnumMap
+{
+    typedef E key_type;
+    typedef T mapped_type;
+
+    /** Values indexed by <c>ToIndex()</c>. */
+    T values[EnumTraits<E>::count];
+
+    /** Returns the number of elements of <c>E</c>. */
+    static constexpr size_t
+    size()
+    {
+        return EnumTraits<E>::count;
+    }
+
+    /** Returns the value for the element <c>e</c>. */
+    T&
+    operator[](E e)
+    {
+        return values[ToIndex(e)];
+    }
+
+    /** Returns the value for the element <c>e</c>. */
+    const T&
+    operator[](E e) const
+    {
+        return values[ToIndex(e)];
+    }
+
+    /** Returns the value for the element <c>e</c> or
+        <c>nullptr</c> if <c>e</c> is not valid. */
+    T*
+    Find(E e)
+    {
+        size_t i = ToIndex(e);
+        return (i < size()) ? &values[i] : nullptr;
+    }
+
+    /** Returns the value for the element <c>e</c> or
+        <c>nullptr</c> if <c>e</c> is not valid. */
+    const T*
+    Find(E e) const
+    {
+        size_t i = ToIndex(e);
+        return (i < size()) ? &values[i] : nullptr;
+    }
+
+    /** Set the value for every element to <c>value</c>. */
+    void
+    Fill(const T& value)
+    {
+        for (size_t i = 0; i < size(); ++i) {
+            values[i] = value;
+        }
+    }
+};
+
+/**
+ * Set of elements of the enumeration <c>E</c> that is stored as a
+ * bitset indexed by <c>ToIndex()</c>.  Counting the elements uses
+ * popcount, and <c>ForEach()</c> visits only the bits that are set
+ * by repeatedly finding the lowest one.  It is an aggregate, so
+ * <c>EnumSet<E> s = {}</c> is empty.  Elements that are not valid are
+ * ignored.
+ *
+ * @param E enumeration type
+ */
+template <typename E>
+struct EnumSet
+{
+    typedef E value_type;
+
+    /** Number of 64-bit words in the bitset. */
+    static constexpr size_t kWords = (EnumTraits<E>::count + 63) / 64;
+
+    /** Bit <c>i</c> is set if the element with index <c>i</c> is in
+        the set. */
+    uint64_t words[kWords];
+
+    /** Add the element <c>e</c> to the set. */
+    void
+    Insert(E e)
+    {
+        size_t i = ToIndex(e);
+        if (i < EnumTraits<E>::count) {
+            words[i / 64] |= (uint64_t)1 << (i % 64);
+        }
+    }
+
+    /** Remove the element <c>e</c> from the set. */
+    void
+    Erase(E e)
+    {
+        size_t i = ToIndex(e);
+        if (i < EnumTraits<E>::count) {
+            words[i / 64] &= ~((uint64_t)1 << (i % 64));
+        }
+    }
+
+    /** Returns true if the element <c>e</c> is in the set. */
+    bool
+    Contains(E e) const
+    {
+        size_t i = ToIndex(e);
+        return ((i < EnumTraits<E>::count) &&
+                ((words[i / 64] >> (i % 64)) & 1));
+    }
+
+    /** Returns the number of elements in the set. */
+    size_t
+    Count() const
+    {
+        size_t result = 0;
+        for (size_t w = 0; w < kWords; ++w) {
+            result += detail::PopCount(words[w]);
+        }
+        return result;
+    }
+
+    /** Remove every element from the set. */
+    void
+    Clear()
+    {
+        for (size_t w = 0; w < kWords; ++w) {
+            words[w] = 0;
+        }
+    }
+
+    /** Call <c>f(e)</c> for each element <c>e</c> in the set in
+        the order the elements were declared. */
+    template <typename F>
+    void
+    ForEach(F f) const
+    {
+        for (size_t w = 0; w < kWords; ++w) {
+            for (uint64_t bits = words[w]; bits != 0; bits &= bits - 1) {
+                f(EnumTraits<E>::values[w * 64
+                                        + detail::CountTrailingZeros(bits)]);
+            }
+        }
+    }
+};
+
+template <typename E>
+constexpr size_t EnumSet<E>::kWords;
+
+/**
+ * Tag passed to the visitor by <c>Dispatch()</c> for the element
+ * <c>V</c>.  The element is part of the type, so code that depends on
+ * it is specialized at compile time, and <c>V</c> is available as the
+ * constant expression <c>decltype(tag)::value</c>.
+ *
+ * @param E enumeration type
+ * @param V element of the enumeration
+ */
+template <typename E, E V>
+using EnumConstant = std::integral_constant<E, V>;
+
+namespace detail {
+
+/**
+ * Sequence of indexes.  <c>std::index_sequence</c> requires C++14.
+ */
+template <size_t... I>
+struct IndexSequence
+{
+};
+
+/**
+ * Concatenate <c>A</c> with <c>B</c> shifted up by the length of
+ * <c>A</c>.
+ */
+template <typename A, typename B>
+struct ConcatIndexSequence;
+
+template <size_t... A, size_t... B>
+struct ConcatIndexSequence<IndexSequence<A...>, IndexSequence<B...> >
+{
+    typedef IndexSequence<A..., (sizeof...(A) + B)...> type;
+};
+
+/**
+ * <c>IndexSequence<0, 1, ..., N - 1></c>.  The range is split in half
+ * at each step so the depth of the recursion is only logarithmic in
+ * <c>N</c>.
+ */
+template <size_t N>
+struct MakeIndexSequence
+    : ConcatIndexSequence<typename MakeIndexSequence<N / 2>::type,
+                          typename MakeIndexSequence<N - N / 2>::type>
+{
+};
+
+template <>
+struct MakeIndexSequence<0>
+{
+    typedef IndexSequence<> type;
+};
+
+template <>
+struct MakeIndexSequence<1>
+{
+    typedef IndexSequence<0> type;
+};
+
+/**
+ * Type returned by <c>Dispatch()</c> which is the type returned by
+ * the visitor for the first element of <c>E</c>.
+ */
+template <typename E, typename Visitor>
+struct DispatchResult
+{
+    typedef decltype(std::declval<Visitor&>()(
+                         EnumConstant<E, EnumTraits<E>::values[0]>()))
+        type;
+};
+
+/**
+ * Call <c>visitor</c> with the tag of the element at index <c>I</c>.
+ */
+template <typename E, typename Visitor, typename R, size_t I>
+R
+DispatchAt(Visitor& visitor)
+{
+    return visitor(EnumConstant<E, EnumTraits<E>::values[I]>());
+}
+
+/**
+ * Call <c>visitor</c> with the tag of the element at index <c>i</c>
+ * through a table with one entry for each index in <c>I</c>.  The
+ * caller must check that <c>i</c> is in range.
+ */
+template <typename E, typename Visitor, typename R, size_t... I>
+R
+DispatchIndex(size_t i,
+              Visitor& visitor,
+              IndexSequence<I...>)
+{
+    static constexpr R (*const table[])(Visitor&) = {
+        &DispatchAt<E, Visitor, R, I>...
+    };
+    return table[i](visitor);
+}
+
+}  /*  namespace detail  */
+
+/**
+ * Call <c>visitor(EnumConstant<E, V>())</c> where <c>V</c> is the
+ * value of <c>e</c> in place of a <c>switch</c> statement.  The
+ * visitor is instantiated for every element, so no element can be
+ * missed, and the call is made by a single indirect call through a
+ * table of function pointers indexed by <c>ToIndex(e)</c>.  Each
+ * instantiation must return a type that converts to the type
+ * returned for the first element.  If <c>e</c> is not valid, the
+ * visitor is not called and a value-initialized result is returned,
+ * so the result type must be <c>void</c> or default constructible;
+ * pass a <c>fallback</c> to handle elements that are not valid
+ * explicitly.
+ *
+ * @param e element to dispatch on
+ * @param visitor function object that accepts the tag of every element
+ */
+template <typename E, typename Visitor>
+typename detail::DispatchResult<
+    E, typename std::remove_reference<Visitor>::type>::type
+Dispatch(E e,
+         Visitor&& visitor)
+{
+    typedef typename std::remove_reference<Visitor>::type V;
+    typedef typename detail::DispatchResult<E, V>::type R;
+    size_t i = ToIndex(e);
+    if (i >= EnumTraits<E>::count) {
+        return R();
+    }
+    return detail::DispatchIndex<E, V, R>(
+        i,
+        visitor,
+        typename detail::MakeIndexSequence<EnumTraits<E>::count>::type());
+}
+
+/**
+ * Same as <c>Dispatch(e, visitor)</c> except <c>fallback(e)</c> is
+ * called instead if <c>e</c> is not valid.
+ *
+ * @param e element to dispatch on
+ * @param visitor function object that accepts the tag of every element
+ * @param fallback function object that accepts an element that is not valid
+ */
+template <typename E, typename Visitor, typename Fallback>
+typename detail::DispatchResult<
+    E, typename std::remove_reference<Visitor>::type>::type
+Dispatch(E e,
+         Visitor&& visitor,
+         Fallback&& fallback)
+{
+    typedef typename std::remove_reference<Visitor>::type V;
+    typedef typename detail::DispatchResult<E, V>::type R;
+    size_t i = ToIndex(e);
+    if (i >= EnumTraits<E>::count) {
+        return fallback(e);
+    }
+    return detail::DispatchIndex<E, V, R>(
+        i,
+        visitor,
+        typename detail::MakeIndexSequence<EnumTraits<E>::count>::type());
+}
+
+}  /*  namespace make_enum  */
+#endif  /*  __cplusplus  */
+
+#if defined(__cplusplus) && \
+    (defined(MAKE_ENUM_STD_FORMAT) || defined(MAKE_ENUM_FMT))
+namespace make_enum {
+namespace detail {
+
+/**
+ * True if <c>E</c> was declared by one of the declaration macros,
+ * which is the case if <c>MakeEnumTraits()</c> is declared for it.
+ *
+ * @param E type to check
+ */
+template <typename E, typename = void>
+struct IsMakeEnum : std::false_type
+{
+};
+
+template <typename E>
+struct IsMakeEnum<E, decltype((void)MakeEnumTraits(std::declval<E>()))>
+    : std::true_type
+{
+};
+
+/**
+ * Implementation of <c>std::formatter<E></c> and
+ * <c>fmt::formatter<E></c>.  The spec may start with "q" for the
+ * qualified name or "u" for the unqualified name, and the rest of it
+ * is handled by <c>Base</c>, which is the formatter for
+ * <c>StringView</c>, so the fill, alignment, width, and precision
+ * work the same as they do for a string.  The name is found by
+ * <c>ToStringView()</c>, so it refers directly to a string literal
+ * and nothing is allocated.
+ *
+ * @param E enumeration type
+ * @param Base formatter for <c>StringView</c>
+ * @param StringView string view type of the formatting library
+ */
+template <typename E, typename Base, typename StringView>
+struct Formatter : Base
+{
+    /** 1 for "q", 0 for "u", and -1 for the default. */
+    int qualified = -1;
+
+    template <typename ParseContext>
+    MAKE_ENUM_CONSTEXPR14 typename ParseContext::iterator
+    parse(ParseContext& ctx)
+    {
+        typename ParseContext::iterator it = ctx.begin();
+        if ((it != ctx.end()) && ((*it == 'q') || (*it == 'u'))) {
+            qualified = (*it == 'q');
+            ctx.advance_to(++it);
+        }
+        return Base::parse(ctx);
+    }
+
+    template <typename FormatContext>
+    auto
+    format(E e,
+           FormatContext& ctx) const -> decltype(ctx.out())
+    {
+        return Base::format(StringView(qualified < 0
+                                       ? ToStringView(e)
+                                       : ToStringView(e,
+                                                      qualified != 0,
+                                                      true)),
+                            ctx);
+    }
+};
+
+}  /*  namespace detail  */
+}  /*  namespace make_enum  */
+
+#ifdef MAKE_ENUM_STD_FORMAT
+namespace std {
+
+/**
+ * Format the elements of any enumeration declared by one of the
+ * declaration macros with <c>std::format()</c>.
+ */
+template <typename E>
+    requires (is_enum_v<E> && make_enum::detail::IsMakeEnum<E>::value)
+struct formatter<E, char>
+    : make_enum::detail::Formatter<E,
+                                   formatter<string_view, char>,
+                                   string_view>
+{
+};
+
+}  /*  namespace std  */
+#endif  /*  MAKE_ENUM_STD_FORMAT  */
+
+#ifdef MAKE_ENUM_FMT
+namespace fmt {
+
+/**
+ * Format the elements of any enumeration declared by one of the
+ * declaration macros with <c>fmt::format()</c>.
+ */
+template <typename E>
+struct formatter<E,
+                 char,
+                 typename std::enable_if<
+                     std::is_enum<E>::value &&
+                     make_enum::detail::IsMakeEnum<E>::value>::type>
+    : make_enum::detail::Formatter<E,
+                                   formatter<string_view, char>,
+                                   string_view>
+{
+};
+
+}  /*  namespace fmt  */
+#endif  /*  MAKE_ENUM_FMT  */
+#endif  /*  __cplusplus && (MAKE_ENUM_STD_FORMAT || MAKE_ENUM_FMT)  */
+
+/************************************************************************
+ * MAKE_ENUM_TRAITS_DECLARATION() -- You should not need to use these
+ * macros directly.
+ ************************************************************************/
+
+#ifndef __cplusplus
+/**
+ * Compile-time traits are only available for C++.
+ *
+ * @param EnumName enumeration name (not used)
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)
+#else
+/**
+ * Internal X macro for adding the name of the enumeration element
+ * <c>ElementName</c> to <c>EnumTraits<EnumName>::names[]</c>.
+ *
+ * @param EnumName enumeration name (not used)
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_TRAITS_NAME(EnumName,                       \
+                                ElementName,                    \
+                                ElementValue)                   \
+    #ElementName,
+
+/**
+ * Internal macro for declaring the compile-time traits of the
+ * enumeration <c>EnumName</c> that are exposed through
+ * <c>make_enum::EnumTraits<EnumName></c>.  The traits are held in a
+ * class template so the static members can be defined in the header
+ * without violating the one definition rule.  The
+ * <c>MakeEnumTraits()</c> function is only ever named inside
+ * <c>decltype</c> so it is never defined.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)               \
+    template <typename T = void>                                            \
+    struct EnumName##_MakeEnumInfo                                          \
+    {                                                                       \
+        typedef EnumName enum_type;                                         \
+        static constexpr size_t count = EnumName##_MakeEnumCount;           \
+        static constexpr EnumName values[] = {                              \
+            ForeachInEnum(EnumName, X_MAKE_ENUM_VALUE)                      \
+        };                                                                  \
+        static constexpr const char* names[] = {                            \
+            ForeachInEnum(EnumName, X_MAKE_ENUM_TRAITS_NAME)                \
+        };                                                                  \
+        static constexpr EnumName min =                                     \
+            make_enum::detail::MinValue(values, 0, count);                  \
+        static constexpr EnumName max =                                     \
+            make_enum::detail::MaxValue(values, 0, count);                  \
+        static constexpr bool is_dense =                                    \
+            ((unsigned long long)make_enum::detail::ToUnderlying(max)       \
+             - (unsigned long long)make_enum::detail::ToUnderlying(min)     \
+             == (unsigned long long)(count - 1));                           \
+    };                                                                      \
+                                                                            \
+    template <typename T>                                                   \
+    constexpr size_t EnumName##_MakeEnumInfo<T>::count;                     \
+    template <typename T>                                                   \
+    constexpr EnumName EnumName##_MakeEnumInfo<T>::values[];                \
+    template <typename T>                                                   \
+    constexpr const char* EnumName##_MakeEnumInfo<T>::names[];              \
+    template <typename T>                                                   \
+    constexpr EnumName EnumName##_MakeEnumInfo<T>::min;                     \
+    template <typename T>                                                   \
+    constexpr EnumName EnumName##_MakeEnumInfo<T>::max;                     \
+    template <typename T>                                                   \
+    constexpr bool EnumName##_MakeEnumInfo<T>::is_dense;                    \
+                                                                            \
+    EnumName##_MakeEnumInfo<> MakeEnumTraits(EnumName);
+#endif  /*  __cplusplus  */
+
+/************************************************************************
+ * ToString() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+/**
+ * Internal macro for declaring the <c>EnumName_ToString()</c>,
+ * <c>EnumName_ToStringLen()</c>, and <c>EnumName_ToStringBatch()</c>
+ * functions.  <c>EnumName</c> should
+ * be the same as the values passed
+ * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_STRING_DECLARATION_BASE(Specifier, EnumName) \
+    Specifier const char*                                         \
+    EnumName##_ToString(enum EnumName e,                          \
+                        int with_enum_name,                       \
+                        int with_element_name);                   \
+                                                                  \
+    Specifier const char*                                         \
+    EnumName##_ToStringLen(enum EnumName e,                       \
+                           int with_enum_name,                    \
+                           int with_element_name,                 \
+                           size_t* len);                          \
+                                                                  \
+    Specifier size_t                                              \
+    EnumName##_ToStringBatch(const enum EnumName* in,             \
+                             size_t n,                            \
+                             char* out,                           \
+                             size_t cap,                          \
+                             int with_enum_name,                  \
+                             int with_element_name,               \
+                             char sep);
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring the
+ * <c>EnumName_ToString()</c> function for an <c>enum</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_STRING_DECLARATION(Specifier,                 \
+                                        EnumName,                  \
+                                        ForeachInEnum)             \
+    MAKE_ENUM_TO_STRING_DECLARATION_BASE(Specifier, EnumName)
+#else
+/**
+ * Internal X macro for converting the enumeration element
+ * <c>ElementName</c> to a <c>MAKE_ENUM_STRING_VIEW</c> inside the
+ * <c>switch</c> statement of <c>ToStringView()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_TO_STRING_VIEW(EnumName,                            \
+                                   ElementName,                         \
+                                   ElementValue)                        \
+    case MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName):               \
+        return (with_enum_name                                          \
+                ? (with_element_name                                    \
+                   ? MAKE_ENUM_STRING_VIEW_LITERAL(                     \
+                       #EnumName "::" #ElementName)                     \
+                   : MAKE_ENUM_STRING_VIEW_LITERAL(#EnumName))          \
+                : (with_element_name                                    \
+                   ? MAKE_ENUM_STRING_VIEW_LITERAL(#ElementName)        \
+                   : MAKE_ENUM_STRING_VIEW_LITERAL("")));
+
+#if MAKE_ENUM_CXX_STD >= 201402L && !defined(MAKE_ENUM_LEAN) && \
+    !defined(MAKE_ENUM_INSTRUMENTED)
+/**
+ * C++14 version of internal macro for declaring and defining the
+ * overloaded <c>ToStringView()</c> function.  It is
+ * <c>constexpr</c>, so it can be evaluated at compile time, and it is
+ * defined in the header, so it can be inlined into its callers.  The
+ * result refers directly to a string literal so nothing is allocated
+ * or copied.  It does not refer to anything that <c>Specifier</c>
+ * might make static, so it is always just <c>constexpr</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions (not used)
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param DefaultWithEnumName default value for <c>with_enum_name</c>
+ */
+#define MAKE_ENUM_TO_STRING_VIEW_DECLARATION(Specifier,                 \
+                                             EnumName,                  \
+                                             ForeachInEnum,             \
+                                             DefaultWithEnumName)       \
+    constexpr MAKE_ENUM_STRING_VIEW                                     \
+    ToStringView(EnumName e,                                            \
+                 bool with_enum_name = DefaultWithEnumName,             \
+                 bool with_element_name = true)                         \
+    {                                                                   \
+        switch (e) {                                                    \
+            ForeachInEnum(EnumName, X_MAKE_ENUM_TO_STRING_VIEW)         \
+        default:                                                        \
+            break;                                                      \
+        }                                                               \
+        return MAKE_ENUM_STRING_VIEW_LITERAL("");                       \
+    }
+
+/**
+ * C++14 version of internal macro for defining the overloaded
+ * <c>ToStringView()</c> function.  It is empty because the function
+ * was defined by <c>MAKE_ENUM_TO_STRING_VIEW_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_STRING_VIEW_DEFINITION(Specifier, EnumName)
+#else
+/**
+ * Internal macro for declaring the overloaded <c>ToStringView()</c>
+ * function when it is not <c>constexpr</c>.  It finds the name with
+ * <c>EnumName_ToStringLen()</c> or <c>EnumName_ToString()</c>, which
+ * are static for <c>MAKE_ENUM_INLINE_DECLARATION()</c>, so it is
+ * declared with the same <c>Specifier</c> and defined by
+ * <c>MAKE_ENUM_TO_STRING_VIEW_DEFINITION()</c> instead of always
+ * being <c>inline</c> in the header.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in
+ *        enum (not used)
+ * @param DefaultWithEnumName default value for <c>with_enum_name</c>
+ */
+#define MAKE_ENUM_TO_STRING_VIEW_DECLARATION(Specifier,                 \
+                                             EnumName,                  \
+                                             ForeachInEnum,             \
+                                             DefaultWithEnumName)       \
+    Specifier MAKE_ENUM_STRING_VIEW                                     \
+    ToStringView(EnumName e,                                            \
+                 bool with_enum_name = DefaultWithEnumName,             \
+                 bool with_element_name = true);
+
+#if MAKE_ENUM_CXX_STD >= 201703L
+/**
+ * C++17 <c>MAKE_ENUM_LEAN</c> version of internal macro for defining
+ * the overloaded <c>ToStringView()</c> function.  It is not
+ * <c>constexpr</c> so the names are found in the table of elements by
+ * <c>EnumName_ToStringLen()</c> instead of by a <c>switch</c>
+ * statement in the header.  It is also used when
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is defined so the conversion is
+ * counted.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_STRING_VIEW_DEFINITION(Specifier, EnumName)        \
+    Specifier MAKE_ENUM_STRING_VIEW                                     \
+    ToStringView(EnumName e,                                            \
+                 bool with_enum_name,                                   \
+                 bool with_element_name)                                \
+    {                                                                   \
+        size_t length = 0;                                              \
+        const char* name = EnumName##_ToStringLen(e,                    \
+                                                  with_enum_name,       \
+                                                  with_element_name,    \
+                                                  &length);             \
+        return MAKE_ENUM_STRING_VIEW(name, length);                     \
+    }
+#else
+/**
+ * C++11 version of internal macro for defining the overloaded
+ * <c>ToStringView()</c> function.  It is the default for C++11, and
+ * it is also used for C++14 when <c>MAKE_ENUM_LEAN</c> or
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is defined.  C++11 does not allow a
+ * <c>switch</c> statement in a <c>constexpr</c> function, so this
+ * version just returns the string literal from
+ * <c>EnumName_ToString()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_STRING_VIEW_DEFINITION(Specifier, EnumName)        \
+    Specifier MAKE_ENUM_STRING_VIEW                                     \
+    ToStringView(EnumName e,                                            \
+                 bool with_enum_name,                                   \
+                 bool with_element_name)                                \
+    {                                                                   \
+        return EnumName##_ToString(e, with_enum_name, with_element_name); \
+    }
+#endif
+#endif
+
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_ToString()</c> function as well as overloaded
+ * <c>ToString()</c>, <c>ToStringView()</c>, and <c>operator<<()</c>
+ * functions for an <c>enum</c>.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_STRING_DECLARATION(Specifier,                      \
+                                        EnumName,                       \
+                                        ForeachInEnum)                  \
+    MAKE_ENUM_TO_STRING_DECLARATION_BASE(Specifier, EnumName)           \
+                                                                        \
+    Specifier std::string                                               \
+    ToString(EnumName e,                                                \
+             bool with_enum_name = false,                               \
+             bool with_element_name = true);                            \
+                                                                        \
+    MAKE_ENUM_TO_STRING_VIEW_DECLARATION(Specifier,                     \
+                                         EnumName,                      \
+                                         ForeachInEnum,                 \
+                                         false)                         \
+                                                                        \
+    Specifier std::ostream&                                             \
+    operator<<(std::ostream& ostrm,                                     \
+               EnumName e);
+
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_ToString()</c> function as well as overloaded
+ * <c>ToString()</c>, <c>ToStringView()</c>, and <c>operator<<()</c>
+ * functions for an <c>enum class</c>.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_TO_STRING_DECLARATION(Specifier,                \
+                                              EnumName,                 \
+                                              ForeachInEnum)            \
+    MAKE_ENUM_TO_STRING_DECLARATION_BASE(Specifier, EnumName)           \
+                                                                        \
+    Specifier std::string                                               \
+    ToString(EnumName e,                                                \
+             bool with_enum_name = true,                                \
+             bool with_element_name = true);                            \
+                                                                        \
+    MAKE_ENUM_TO_STRING_VIEW_DECLARATION(Specifier,                     \
+                                         EnumName,                      \
+                                         ForeachInEnum,                 \
+                                         true)                          \
+                                                                        \
+    Specifier std::ostream&                                             \
+    operator<<(std::ostream& ostrm,                                     \
+               EnumName e);
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_ToString()</c>,
+ * <c>EnumName_ToStringLen()</c>, and <c>EnumName_ToStringBatch()</c>
+ * functions for an <c>enum</c> or an <c>enum class</c>.  The names
+ * and their lengths are loaded from the table of elements which must
+ * have already been defined by <c>MAKE_ENUM_TABLE_DEFINITION()</c>,
+ * so converting an element to a string is a bounds check plus one
+ * load when the values of the elements are sequential, and the names
+ * never need to be scanned for their lengths.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(Specifier,            \
+                                              EnumName,             \
+                                              ForeachInEnum)        \
+    Specifier const char*                                           \
+    EnumName##_ToStringLen(enum EnumName e,                         \
+                           int with_enum_name,                      \
+                           int with_element_name,                   \
+                           size_t* len)                             \
+    {                                                               \
+        const char* result = "";                                    \
+        size_t length = 0;                                          \
+        size_t i = EnumName##_MakeEnumIndexOf(e);                   \
+                                                                    \
+        if (i < (size_t)EnumName##_MakeEnumCount) {                 \
+            MAKE_ENUM_COUNT(EnumName, elements[i].to_string);       \
+            if (with_enum_name && with_element_name) {              \
+                result = EnumName##_MakeEnumEntries[i].qualified_name; \
+                length = EnumName##_MakeEnumEntries[i].qualified_name_length; \
+            } else if (with_enum_name && !with_element_name) {      \
+                result = #EnumName;                                 \
+                length = sizeof(#EnumName) - 1;                     \
+            } else if (!with_enum_name && with_element_name) {      \
+                result = EnumName##_MakeEnumEntries[i].name;        \
+                length = EnumName##_MakeEnumEntries[i].name_length; \
+            }                                                       \
+        }                                                           \
+        if (len) {                                                  \
+            *len = length;                                          \
+        }                                                           \
+        return result;                                              \
+    }                                                               \
+                                                                    \
+    Specifier const char*                                           \
+    EnumName##_ToString(enum EnumName e,                            \
+                        int with_enum_name,                         \
+                        int with_element_name)                      \
+    {                                                               \
+        return EnumName##_ToStringLen(e,                            \
+                                      with_enum_name,               \
+                                      with_element_name,            \
+                                      NULL);                        \
+    }                                                               \
+                                                                    \
+    Specifier size_t                                                \
+    EnumName##_ToStringBatch(const enum EnumName* in,               \
+                             size_t n,                              \
+                             char* out,                             \
+                             size_t cap,                            \
+                             int with_enum_name,                    \
+                             int with_element_name,                 \
+                             char sep)                              \
+    {                                                               \
+        size_t result = 0;                                          \
+        size_t i = 0;                                               \
+        const char* name = NULL;                                    \
+        size_t length = 0;                                          \
+                                                                    \
+        for (i = 0; i < n; ++i) {                                   \
+            name = EnumName##_ToStringLen(in[i],                    \
+                                          with_enum_name,           \
+                                          with_element_name,        \
+                                          &length);                 \
+            if (i > 0) {                                            \
+                if (result < cap) {                                 \
+                    out[result] = sep;                              \
+                }                                                   \
+                ++result;                                           \
+            }                                                       \
+            if (result < cap) {                                     \
+                memcpy(out + result,                                \
+                       name,                                        \
+                       (length < cap - result) ? length : cap - result); \
+            }                                                       \
+            result += length;                                       \
+        }                                                           \
+        if (cap > 0) {                                              \
+            out[(result < cap) ? result : cap - 1] = '\0';          \
+        }                                                           \
+        return result;                                              \
+    }
+
+#ifdef __cplusplus
+/**
+ * Internal macro for defining the overloaded <c>ToString()</c>,
+ * <c>ToStringView()</c> (unless it is <c>constexpr</c>), and
+ * <c>operator<<()</c> functions for an <c>enum</c> or an <c>enum
+ * class</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>. <p>
+ *
+ * This macro works for both <c>enum</c> and <c>enum class</c>
+ * enumerations because the enum logic is in the
+ * <c>EnumName_ToString()</c> function which is defined elsewhere.
+ * Also, the *declaration* macros are responsible for setting the
+ * default values differently for <c>enum</c> and <c>enum class</c> so
+ * the former default to generating just the element name (e.g.,
+ * "FOO") while the later default to generating the full, scoped name
+ * (e.g., "MyEnum::FOO").  <c>operator<<()</c> does not go through
+ * <c>ToString()</c>, so the definition macros pass the same default
+ * in <c>DefaultWithEnumName</c>. <p>
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ * @param DefaultWithEnumName default value for <c>with_enum_name</c>
+ */
+#define MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(Specifier,             \
+                                                EnumName,              \
+                                                ForeachInEnum,         \
+                                                DefaultWithEnumName)   \
+    Specifier std::string                                              \
+    ToString(EnumName e,                                               \
+             bool with_enum_name,                                      \
+             bool with_element_name)                                   \
+    {                                                                  \
+        size_t length = 0;                                             \
+        const char* name = EnumName##_ToStringLen(e,                   \
+                                                  with_enum_name,      \
+                                                  with_element_name,   \
+                                                  &length);            \
+        return std::string(name, length);                              \
+    }                                                                  \
+                                                                       \
+    Specifier std::ostream&                                            \
+    operator<<(std::ostream& ostrm,                                    \
+               EnumName e)                                             \
+    {                                                                  \
+        size_t length = 0;                                             \
+        const char* name = EnumName##_ToStringLen(e,                   \
+                                                  DefaultWithEnumName, \
+                                                  1,                   \
+                                                  &length);            \
+        return make_enum::detail::WriteName(ostrm, name, length);      \
+    }                                                                  \
+                                                                       \
+    MAKE_ENUM_TO_STRING_VIEW_DEFINITION(Specifier, EnumName)
+#endif
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for defining the
+ * <c>EnumName_ToString()</c> function for an <c>enum</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_STRING_DEFINITION(Specifier,                   \
+                                       EnumName,                    \
+                                       ForeachInEnum)               \
+    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(Specifier,                \
+                                          EnumName,                 \
+                                          ForeachInEnum)
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_ToString()</c> function as well as overloaded
+ * <c>ToString()</c> and <c>operator<<()</c> functions for an
+ * <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be
+ * the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_STRING_DEFINITION(Specifier,                       \
+                                       EnumName,                        \
+                                       ForeachInEnum)                   \
+    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(Specifier,                    \
+                                          EnumName,                     \
+                                          ForeachInEnum)                \
+    MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(Specifier,                  \
+                                            EnumName,                   \
+                                            ForeachInEnum,              \
+                                            0)
+
+/**
+ * Internal macro for defining the <c>EnumName_ToString()</c> function
+ * as well as overloaded <c>ToString()</c> and <c>operator<<()</c>
+ * functions for an <c>enum class</c>.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_TO_STRING_DEFINITION(Specifier,                 \
+                                             EnumName,                  \
+                                             ForeachInEnum)             \
+    MAKE_ENUM_TO_STRING_DEFINITION_BASE_C(Specifier,                    \
+                                          EnumName,                     \
+                                          ForeachInEnum)                \
+    MAKE_ENUM_TO_STRING_DEFINITION_BASE_CXX(Specifier,                  \
+                                            EnumName,                   \
+                                            ForeachInEnum,              \
+                                            1)
+#endif  /*  __cplusplus  */
+
+/************************************************************************
+ * FromString() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+/**
+ * Internal macro for declaring the <c>EnumName_FromString()</c>,
+ * <c>EnumName_FromStringN()</c>, <c>EnumName_FromStringBatch()</c>,
+ * <c>EnumName_DecodeColumn()</c>, <c>EnumName_FromStringCI()</c>, and
+ * <c>EnumName_FromStringCIN()</c> functions.  <c>EnumName</c>
+ * should be the same as the values passed
+ * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_DECLARATION_BASE(Specifier, EnumName) \
+    Specifier int                                                   \
+    EnumName##_FromString(enum EnumName* e,                         \
+                          const char* s);                           \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FromStringN(enum EnumName* e,                        \
+                           const char* s,                           \
+                           size_t n);                               \
+                                                                    \
+    Specifier size_t                                                \
+    EnumName##_FromStringBatch(const char* const* strs,             \
+                               const size_t* lens,                  \
+                               size_t n,                            \
+                               enum EnumName* out,                  \
+                               unsigned char* ok);                  \
+                                                                    \
+    Specifier size_t                                                \
+    EnumName##_DecodeColumn(const char* begin,                      \
+                            const char* end,                        \
+                            char delim,                             \
+                            enum EnumName* out,                     \
+                            size_t cap,                             \
+                            size_t* consumed);                      \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FromStringCI(enum EnumName* e,                       \
+                            const char* s);                         \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FromStringCIN(enum EnumName* e,                      \
+                             const char* s,                         \
+                             size_t n);
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring the
+ * <c>EnumName_FromString()</c> function.  <c>EnumName</c> should be
+ * the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_DECLARATION(Specifier, EnumName) \
+    MAKE_ENUM_FROM_STRING_DECLARATION_BASE(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_FromString()</c> function as well as overloaded
+ * <c>FromString()</c>, <c>FromStringBatch()</c>,
+ * <c>DecodeColumn()</c>, <c>FromStringCI()</c>, and
+ * <c>operator>>()</c> functions.
+ * <c>EnumName</c> should be the same as the values passed into the
+ * corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_DECLARATION(Specifier, EnumName)  \
+    MAKE_ENUM_FROM_STRING_DECLARATION_BASE(Specifier, EnumName) \
+                                                                \
+    Specifier bool                                              \
+    FromString(EnumName& e,                                     \
+               const std::string& s);                           \
+                                                                \
+    Specifier bool                                              \
+    FromString(EnumName& e,                                     \
+               const char* s);                                  \
+                                                                \
+    Specifier size_t                                            \
+    FromStringBatch(const std::string* strs,                    \
+                    size_t n,                                   \
+                    EnumName* out,                              \
+                    unsigned char* ok);                         \
+                                                                \
+    Specifier size_t                                            \
+    DecodeColumn(const char* begin,                             \
+                 const char* end,                               \
+                 char delim,                                    \
+                 EnumName* out,                                 \
+                 size_t cap,                                    \
+                 size_t* consumed);                             \
+                                                                \
+    Specifier bool                                              \
+    FromStringCI(EnumName& e,                                   \
+                 const std::string& s);                         \
+                                                                \
+    Specifier bool                                              \
+    FromStringCI(EnumName& e,                                   \
+                 const char* s);                                \
+                                                                \
+    MAKE_ENUM_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName) \
+                                                                \
+    Specifier std::istream&                                     \
+    operator>>(std::istream& istrm,                             \
+               EnumName& e);
+
+#if MAKE_ENUM_CXX_STD >= 202002L
+/**
+ * C++20 version of internal macro for declaring the overloaded
+ * <c>FromStringBatch()</c> function that converts a
+ * <c>std::span</c> of <c>std::string_view</c>.  <c>EnumName</c>
+ * should be the same as the values passed into the corresponding call
+ * to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_SPAN_DECLARATION(Specifier, EnumName) \
+    Specifier size_t                                                \
+    FromStringBatch(std::span<const std::string_view> strs,         \
+                    std::span<EnumName> out,                        \
+                    unsigned char* ok);
+
+/**
+ * C++20 version of internal macro for defining the overloaded
+ * <c>FromStringBatch()</c> function that converts a
+ * <c>std::span</c> of <c>std::string_view</c>.  Only as many strings
+ * as fit in <c>out</c> are converted.  <c>EnumName</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_SPAN_DEFINITION(Specifier, EnumName)  \
+    Specifier size_t                                                \
+    FromStringBatch(std::span<const std::string_view> strs,         \
+                    std::span<EnumName> out,                        \
+                    unsigned char* ok)                              \
+    {                                                               \
+        return FromStringBatch(strs.data(),                         \
+                               ((strs.size() < out.size())          \
+                                ? strs.size()                       \
+                                : out.size()),                      \
+                               out.data(),                          \
+                               ok);                                 \
+    }
+#else
+/**
+ * Pre-C++20 version of internal macro for declaring the overloaded
+ * <c>FromStringBatch()</c> function that converts a
+ * <c>std::span</c>.  It is empty because <c>std::span</c> requires
+ * C++20.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_SPAN_DECLARATION(Specifier, EnumName)
+
+/**
+ * Pre-C++20 version of internal macro for defining the overloaded
+ * <c>FromStringBatch()</c> function that converts a
+ * <c>std::span</c>.  It is empty because <c>std::span</c> requires
+ * C++20.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_SPAN_DEFINITION(Specifier, EnumName)
+#endif
+
+#if MAKE_ENUM_CXX_STD >= 201703L
+/**
+ * C++17 version of internal macro for declaring the overloaded
+ * <c>FromString()</c>, <c>FromStringBatch()</c>, and
+ * <c>FromStringCI()</c> functions that parse a
+ * <c>std::string_view</c>.  <c>EnumName</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName) \
+    Specifier bool                                                  \
+    FromString(EnumName& e,                                         \
+               std::string_view s);                                 \
+                                                                    \
+    Specifier size_t                                                \
+    FromStringBatch(const std::string_view* strs,                   \
+                    size_t n,                                       \
+                    EnumName* out,                                  \
+                    unsigned char* ok);                             \
+                                                                    \
+    MAKE_ENUM_FROM_STRING_SPAN_DECLARATION(Specifier, EnumName)     \
+                                                                    \
+    Specifier bool                                                  \
+    FromStringCI(EnumName& e,                                       \
+                 std::string_view s);
+#else
+/**
+ * Pre-C++17 version of internal macro for declaring the overloaded
+ * <c>FromString()</c>, <c>FromStringBatch()</c>, and
+ * <c>FromStringCI()</c> functions that parse a
+ * <c>std::string_view</c>.  It is empty because
+ * <c>std::string_view</c> requires C++17.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName)
+#endif
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_FromStringBatch()</c>
+ * function for an <c>enum</c> or an <c>enum class</c>.  It converts
+ * the <c>n</c> strings in <c>strs</c> by calling
+ * <c>EnumName_FromStringN()</c> which is defined in the same
+ * translation unit, so the lookup is inlined into the loop instead of
+ * being called once per string.  If <c>lens</c> is null, the
+ * strings must be null terminated.  If <c>ok</c> is not null,
+ * <c>ok[i]</c> is set to 1 if <c>strs[i]</c> was converted and to 0
+ * otherwise.  Elements of <c>out</c> for strings that could not be
+ * converted are not modified.  Returns the number of strings that
+ * were converted.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_BATCH_DEFINITION(Specifier, EnumName)     \
+    Specifier size_t                                                    \
+    EnumName##_FromStringBatch(const char* const* strs,                 \
+                               const size_t* lens,                      \
+                               size_t n,                                \
+                               enum EnumName* out,                      \
+                               unsigned char* ok)                       \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t i = 0;                                                   \
+        int converted = 0;                                              \
+                                                                        \
+        if (!strs || !out) {                                            \
+            goto out;                                                   \
+        }                                                               \
+        for (i = 0; i < n; ++i) {                                       \
+            converted = EnumName##_FromStringN(                         \
+                &out[i],                                                \
+                strs[i],                                                \
+                (lens ? lens[i] : (strs[i] ? strlen(strs[i]) : 0)));    \
+            if (ok) {                                                   \
+                ok[i] = (unsigned char)converted;                       \
+            }                                                           \
+            result += (size_t)converted;                                \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }
+
+/**
+ * Internal macro for defining the <c>EnumName_DecodeColumn()</c>
+ * function for an <c>enum</c> or an <c>enum class</c>.  Each token is
+ * found with <c>memchr()</c>, which the C library vectorizes, and is
+ * converted in place by <c>EnumName_FromStringN()</c> which is
+ * defined in the same translation unit, so a column of a large
+ * memory-mapped file can be decoded without splitting it into
+ * strings.  Decoding stops at the first token that is not an
+ * element, so <c>*consumed</c> is where the caller should look for
+ * it, or it stops when <c>cap</c> elements have been written, so
+ * <c>*consumed</c> is where the caller should resume.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_DECODE_COLUMN_DEFINITION(Specifier, EnumName)         \
+    Specifier size_t                                                    \
+    EnumName##_DecodeColumn(const char* begin,                          \
+                            const char* end,                            \
+                            char delim,                                 \
+                            enum EnumName* out,                         \
+                            size_t cap,                                 \
+                            size_t* consumed)                           \
+    {                                                                   \
+        size_t result = 0;                                              \
+        const char* p = begin;                                          \
+        const char* token_end = NULL;                                   \
+                                                                        \
+        if (!begin || !end || !out) {                                   \
+            goto out;                                                   \
+        }                                                               \
+        while ((p < end) && (result < cap)) {                           \
+            token_end = (const char*)memchr(p, delim, (size_t)(end - p)); \
+            if (!token_end) {                                           \
+                token_end = end;                                        \
+            }                                                           \
+            if (!EnumName##_FromStringN(&out[result],                   \
+                                        p,                              \
+                                        (size_t)(token_end - p)))       \
+            {                                                           \
+                break;                                                  \
+            }                                                           \
+            ++result;                                                   \
+            p = (token_end < end) ? token_end + 1 : end;                \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        if (consumed) {                                                 \
+            *consumed = (size_t)(p - begin);                            \
+        }                                                               \
+        return result;                                                  \
+    }
+
+/**
+ * Internal macro for defining the <c>EnumName_FromStringCI()</c> and
+ * <c>EnumName_FromStringCIN()</c> functions for an <c>enum</c> or an
+ * <c>enum class</c>.  They are the same as
+ * <c>EnumName_FromString()</c> and <c>EnumName_FromStringN()</c>
+ * except ASCII case is ignored and <c>MAKE_ENUM_ALT_SEPARATOR</c> is
+ * accepted in place of "::".  The name of the enumeration, if
+ * present, is stripped so only the unscoped name has to be looked up
+ * by <c>EnumName_MakeEnumFindIgnoreCase()</c> which must have already
+ * been defined.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_CI_DEFINITION(Specifier, EnumName)        \
+    Specifier int                                                       \
+    EnumName##_FromStringCI(enum EnumName* e,                           \
+                            const char* s)                              \
+    {                                                                   \
+        return EnumName##_FromStringCIN(e, s, s ? strlen(s) : 0);       \
+    }                                                                   \
+                                                                        \
+    Specifier int                                                       \
+    EnumName##_FromStringCIN(enum EnumName* e,                          \
+                             const char* s,                             \
+                             size_t n)                                  \
+    {                                                                   \
+        int result = 0;                                                 \
+        size_t prefix = sizeof(#EnumName) - 1;                          \
+        const struct EnumName##_MakeEnumEntry* entry = NULL;            \
+                                                                        \
+        if (!s || !e) {                                                 \
+            goto out;                                                   \
+        }                                                               \
+        if ((n > prefix) &&                                             \
+            MakeEnum_EqualIgnoreCase(s, #EnumName, prefix))             \
+        {                                                               \
+            if ((n > prefix + 1) &&                                     \
+                (s[prefix] == ':') &&                                   \
+                (s[prefix + 1] == ':'))                                 \
+            {                                                           \
+                s += prefix + 2;                                        \
+                n -= prefix + 2;                                        \
+            } else if (s[prefix] == MAKE_ENUM_ALT_SEPARATOR) {          \
+                s += prefix + 1;                                        \
+                n -= prefix + 1;                                        \
+            }                                                           \
+        }                                                               \
+        entry = EnumName##_MakeEnumFindIgnoreCase(s, n);                \
+        if (entry) {                                                    \
+            *e = entry->value;                                          \
+            result = 1;                                                 \
+            MAKE_ENUM_COUNT(EnumName,                                   \
+                            elements[entry - EnumName##_MakeEnumEntries] \
+                            .from_string);                              \
+        } else {                                                        \
+            MAKE_ENUM_COUNT(EnumName, from_string_misses.value);        \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }
+
+#if defined(__cplusplus) && MAKE_ENUM_CXX_STD >= 201402L && \
+    !defined(MAKE_ENUM_LEAN)
+/**
+ * C++14 version of internal macro for defining the
+ * <c>EnumName_MakeEnumFind()</c> function that returns the entry in
+ * the table of elements with a scoped or unscoped name equal to the
+ * <c>n</c> bytes starting at <c>s</c> or <c>NULL</c> if there is no
+ * such entry.  The unscoped names are sorted at compile time by their
+ * first eight bytes packed into a 64-bit key, then by their lengths,
+ * and then by their remaining bytes, so the entry is found by a
+ * binary search over the keys after the "EnumName::" prefix of a
+ * scoped name is removed.  <c>EnumName_MakeEnumFindIgnoreCase()</c>
+ * does the same for an unscoped name over a second table whose names
+ * are sorted and compared ignoring ASCII case, so it costs the same
+ * as the exact lookup.  The table of elements must have already been
+ * defined by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FIND_DEFINITION(EnumName)                             \
+    static constexpr auto EnumName##_MakeEnumSortedNames =              \
+        make_enum::detail::MakeSortedNames<                             \
+            (sizeof(EnumName##_MakeEnumEntries)                         \
+             / sizeof(EnumName##_MakeEnumEntries[0]))>(                 \
+                 EnumName##_MakeEnumEntries);                           \
+                                                                        \
+    static constexpr auto EnumName##_MakeEnumSortedNamesIgnoreCase =    \
+        make_enum::detail::MakeSortedNames<                             \
+            (sizeof(EnumName##_MakeEnumEntries)                         \
+             / sizeof(EnumName##_MakeEnumEntries[0])),                  \
+            true>(EnumName##_MakeEnumEntries);                          \
+                                                                        \
+    MAKE_ENUM_INLINE const struct EnumName##_MakeEnumEntry*             \
+    EnumName##_MakeEnumFind(const char* s,                              \
+                            size_t n)                                   \
+    {                                                                   \
+        size_t prefix = sizeof(#EnumName "::") - 1;                     \
+                                                                        \
+        if ((n > prefix) && (memcmp(s, #EnumName "::", prefix) == 0)) { \
+            s += prefix;                                                \
+            n -= prefix;                                                \
+        }                                                               \
+        return EnumName##_MakeEnumSortedNames.Find(                     \
+            EnumName##_MakeEnumEntries,                                 \
+            s,                                                          \
+            n);                                                         \
+    }                                                                   \
+                                                                        \
+    MAKE_ENUM_INLINE const struct EnumName##_MakeEnumEntry*             \
+    EnumName##_MakeEnumFindIgnoreCase(const char* s,                    \
+                                      size_t n)                         \
+    {                                                                   \
+        return EnumName##_MakeEnumSortedNamesIgnoreCase.Find(           \
+            EnumName##_MakeEnumEntries,                                 \
+            s,                                                          \
+            n);                                                         \
+    }
+#else
+/**
+ * Internal macro for defining the <c>EnumName_MakeEnumFind()</c>
+ * function that returns the entry in the table of elements with a
+ * scoped or unscoped name equal to the <c>n</c> bytes starting at
+ * <c>s</c> or <c>NULL</c> if there is no such entry.
+ * <c>EnumName_MakeEnumFindIgnoreCase()</c> does the same for an
+ * unscoped name ignoring ASCII case.  C and C++11 cannot sort the
+ * names at compile time, and <c>MAKE_ENUM_LEAN</c> does not, so the
+ * table is scanned in order.  Because the table records the length
+ * of each name, most elements are rejected by comparing lengths, and
+ * only names of the same length as <c>s</c> are compared byte by
+ * byte.  The table of elements must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FIND_DEFINITION(EnumName)                             \
+    MAKE_ENUM_INLINE const struct EnumName##_MakeEnumEntry*             \
+    EnumName##_MakeEnumFind(const char* s,                              \
+                            size_t n)                                   \
+    {                                                                   \
+        const struct EnumName##_MakeEnumEntry* result = NULL;           \
+        const struct EnumName##_MakeEnumEntry* entry = NULL;            \
+        size_t i = 0;                                                   \
+                                                                        \
+        for (i = 0;                                                     \
+             i < (sizeof(EnumName##_MakeEnumEntries)                    \
+                  / sizeof(EnumName##_MakeEnumEntries[0]));             \
+             ++i)                                                       \
+        {                                                               \
+            entry = &EnumName##_MakeEnumEntries[i];                     \
+            if (((entry->name_length == n) &&                           \
+                 (memcmp(entry->name, s, n) == 0)) ||                   \
+                ((entry->qualified_name_length == n) &&                 \
+                 (memcmp(entry->qualified_name, s, n) == 0)))           \
+            {                                                           \
+                result = entry;                                         \
+                break;                                                  \
+            }                                                           \
+        }                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    MAKE_ENUM_INLINE const struct EnumName##_MakeEnumEntry*             \
+    EnumName##_MakeEnumFindIgnoreCase(const char* s,                    \
+                                      size_t n)                         \
+    {                                                                   \
+        const struct EnumName##_MakeEnumEntry* result = NULL;           \
+        size_t i = 0;                                                   \
+                                                                        \
+        for (i = 0;                                                     \
+             i < (sizeof(EnumName##_MakeEnumEntries)                    \
+                  / sizeof(EnumName##_MakeEnumEntries[0]));             \
+             ++i)                                                       \
+        {                                                               \
+            if ((EnumName##_MakeEnumEntries[i].name_length == n) &&     \
+                MakeEnum_EqualIgnoreCase(EnumName##_MakeEnumEntries[i].name, \
+                                         s,                             \
+                                         n))                            \
+            {                                                           \
+                result = &EnumName##_MakeEnumEntries[i];                \
+                break;                                                  \
+            }                                                           \
+        }                                                               \
+        return result;                                                  \
+    }
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_FromString()</c>
+ * function for an <c>enum</c> or an <c>enum class</c>.  The string is
+ * matched against the scoped and unscoped names in the table of
+ * elements which must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  For C++14, the names are
+ * looked up by a binary search over a table that is sorted at compile
+ * time.  Otherwise, they are scanned in order, but most elements are
+ * rejected by comparing lengths.  <c>EnumName_FromStringCI()</c> is
+ * looked up the same way except ASCII case is ignored.  See
+ * <c>MAKE_ENUM_FIND_DEFINITION()</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(Specifier,              \
+                                                EnumName,               \
+                                                ForeachInEnum)          \
+    MAKE_ENUM_FIND_DEFINITION(EnumName)                                 \
+                                                                        \
+    Specifier int                                                       \
+    EnumName##_FromString(enum EnumName* e,                             \
+                          const char* s)                                \
+    {                                                                   \
+        return EnumName##_FromStringN(e, s, s ? strlen(s) : 0);         \
+    }                                                                   \
+                                                                        \
+    Specifier int                                                       \
+    EnumName##_FromStringN(enum EnumName* e,                            \
+                           const char* s,                               \
+                           size_t n)                                    \
+    {                                                                   \
+        int result = 0;                                                 \
+        const struct EnumName##_MakeEnumEntry* entry = NULL;            \
+                                                                        \
+        if (!s || !e) {                                                 \
+            goto out;                                                   \
+        }                                                               \
+        entry = EnumName##_MakeEnumFind(s, n);                          \
+        if (entry) {                                                    \
+            *e = entry->value;                                          \
+            result = 1;                                                 \
+            MAKE_ENUM_COUNT(EnumName,                                   \
+                            elements[entry - EnumName##_MakeEnumEntries] \
+                            .from_string);                              \
+        } else {                                                        \
+            MAKE_ENUM_COUNT(EnumName, from_string_misses.value);        \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    MAKE_ENUM_FROM_STRING_BATCH_DEFINITION(Specifier, EnumName)         \
+    MAKE_ENUM_DECODE_COLUMN_DEFINITION(Specifier, EnumName)             \
+    MAKE_ENUM_FROM_STRING_CI_DEFINITION(Specifier, EnumName)
+
+#ifdef __cplusplus
+/**
+ * Internal macro for defining the overloaded <c>FromString()</c>,
+ * <c>FromStringBatch()</c>, <c>FromStringCI()</c>, and
+ * <c>operator>>()</c> functions for an <c>enum</c> or an <c>enum
+ * class</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASSDECLARATION()</c>. <p>
+ *
+ * This macro works for both <c>enum</c> and <c>enum class</c>
+ * enumerations because the enum logic is in the
+ * <c>EnumName_FromString()</c> function which is defined
+ * elsewhere. <p>
+ *
+ * Instead of extracting a <c>std::string</c>, <c>operator>>()</c>
+ * reads the token directly from the stream buffer into a fixed-size
+ * buffer on the stack that is just large enough to hold the longest
+ * name.  The bytes of a longer token that do not fit are not stored,
+ * but they are still consumed up to the next whitespace, and then the
+ * token is rejected.  So the behavior is the same as extracting a
+ * <c>std::string</c> and calling <c>FromString()</c>:  leading
+ * whitespace is skipped, the whole token is consumed, the width of
+ * the stream is honored, and failbit is set if the token is not the
+ * name of an element. <p>
+ */
+#define MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(Specifier,        \
+                                                  EnumName,         \
+                                                  ForeachInEnum)    \
+    Specifier bool                                                  \
+    FromString(EnumName& e,                                         \
+               const std::string& s)                                \
+    {                                                               \
+        return (bool)EnumName##_FromStringN(&e, s.data(), s.size()); \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FromString(EnumName& e,                                         \
+               const char* s)                                       \
+    {                                                               \
+        return (bool)EnumName##_FromString(&e, s);                  \
+    }                                                               \
+                                                                    \
+    Specifier size_t                                                \
+    FromStringBatch(const std::string* strs,                        \
+                    size_t n,                                       \
+                    EnumName* out,                                  \
+                    unsigned char* ok)                              \
+    {                                                               \
+        size_t result = 0;                                          \
+        for (size_t i = 0; i < n; ++i) {                            \
+            int converted = EnumName##_FromStringN(&out[i],         \
+                                                   strs[i].data(),  \
+                                                   strs[i].size()); \
+            if (ok) {                                               \
+                ok[i] = (unsigned char)converted;                   \
+            }                                                       \
+            result += (size_t)converted;                            \
+        }                                                           \
+        return result;                                              \
+    }                                                               \
+                                                                    \
+    Specifier size_t                                                \
+    DecodeColumn(const char* begin,                                 \
+                 const char* end,                                   \
+                 char delim,                                        \
+                 EnumName* out,                                     \
+                 size_t cap,                                        \
+                 size_t* consumed)                                  \
+    {                                                               \
+        return EnumName##_DecodeColumn(begin,                       \
+                                       end,                         \
+                                       delim,                       \
+                                       out,                         \
+                                       cap,                         \
+                                       consumed);                   \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FromStringCI(EnumName& e,                                       \
+                 const std::string& s)                              \
+    {                                                               \
+        return (bool)EnumName##_FromStringCIN(&e, s.data(), s.size()); \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FromStringCI(EnumName& e,                                       \
+                 const char* s)                                     \
+    {                                                               \
+        return (bool)EnumName##_FromStringCI(&e, s);                \
+    }                                                               \
+                                                                    \
+    MAKE_ENUM_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName)      \
+                                                                    \
+    Specifier std::istream&                                         \
+    operator>>(std::istream& istrm,                                 \
+               EnumName& e)                                         \
+    {                                                               \
+        typedef std::istream::traits_type traits_type;              \
+        char token[make_enum::detail::MaxNameLength(                \
+                       EnumName##_MakeEnumEntries,                  \
+                       0,                                           \
+                       (sizeof(EnumName##_MakeEnumEntries)          \
+                        / sizeof(EnumName##_MakeEnumEntries[0])))]; \
+        size_t n = 0;                                               \
+        size_t limit = (size_t)-1;                                  \
+        std::ios::iostate state = std::ios::goodbit;                \
+        std::istream::sentry sentry(istrm);                         \
+                                                                    \
+        if (!sentry) {                                              \
+            return istrm;                                           \
+        }                                                           \
+        if (istrm.width() > 0) {                                    \
+            limit = (size_t)istrm.width();                          \
+        }                                                           \
+        const std::ctype<char>& ctype =                             \
+            std::use_facet<std::ctype<char> >(istrm.getloc());      \
+        std::streambuf* sb = istrm.rdbuf();                         \
+        for (traits_type::int_type c = sb->sgetc();                 \
+             ;                                                      \
+             c = sb->snextc())                                      \
+        {                                                           \
+            if (traits_type::eq_int_type(c, traits_type::eof())) {  \
+                state |= std::ios::eofbit;                          \
+                break;                                              \
+            }                                                       \
+            char ch = traits_type::to_char_type(c);                 \
+            if ((n == limit) ||                                     \
+                ctype.is(std::ctype_base::space, ch))               \
+            {                                                       \
+                break;                                              \
+            }                                                       \
+            if (n < sizeof(token)) {                                \
+                token[n] = ch;                                      \
+            }                                                       \
+            ++n;                                                    \
+        }                                                           \
+        istrm.width(0);                                             \
+        if ((n == 0) ||                                             \
+            (n > sizeof(token)) ||                                  \
+            !EnumName##_FromStringN(&e, token, n))                  \
+        {                                                           \
+            state |= std::ios::failbit;                             \
+        }                                                           \
+        istrm.setstate(state);                                      \
+        return istrm;                                               \
+    }
+#endif
+
+#ifdef __cplusplus
+#if MAKE_ENUM_CXX_STD >= 201703L
+/**
+ * C++17 version of internal macro for defining the overloaded
+ * <c>FromString()</c>, <c>FromStringBatch()</c>, and
+ * <c>FromStringCI()</c> functions that parse a
+ * <c>std::string_view</c> without copying it.  <c>EnumName</c> should
+ * be the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName)      \
+    Specifier bool                                                      \
+    FromString(EnumName& e,                                             \
+               std::string_view s)                                      \
+    {                                                                   \
+        return (bool)EnumName##_FromStringN(&e, s.data(), s.size());    \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    FromStringBatch(const std::string_view* strs,                       \
+                    size_t n,                                           \
+                    EnumName* out,                                      \
+                    unsigned char* ok)                                  \
+    {                                                                   \
+        size_t result = 0;                                              \
+        for (size_t i = 0; i < n; ++i) {                                \
+            int converted = EnumName##_FromStringN(&out[i],             \
+                                                   strs[i].data(),      \
+                                                   strs[i].size());     \
+            if (ok) {                                                   \
+                ok[i] = (unsigned char)converted;                       \
+            }                                                           \
+            result += (size_t)converted;                                \
+        }                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    MAKE_ENUM_FROM_STRING_SPAN_DEFINITION(Specifier, EnumName)          \
+                                                                        \
+    Specifier bool                                                      \
+    FromStringCI(EnumName& e,                                           \
+                 std::string_view s)                                    \
+    {                                                                   \
+        return (bool)EnumName##_FromStringCIN(&e, s.data(), s.size());  \
+    }
+#else
+/**
+ * Pre-C++17 version of internal macro for defining the overloaded
+ * <c>FromString()</c>, <c>FromStringBatch()</c>, and
+ * <c>FromStringCI()</c> functions that parse a
+ * <c>std::string_view</c>.  It is empty because
+ * <c>std::string_view</c> requires C++17.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName)
+#endif
+#endif  /*  __cplusplus  */
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for defining the
+ * <c>EnumName_FromString()</c> function for an <c>enum</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FROM_STRING_DEFINITION(Specifier,                     \
+                                         EnumName,                      \
+                                         ForeachInEnum)                 \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(Specifier,                  \
+                                            EnumName,                   \
+                                            ForeachInEnum)
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_FromString()</c> function as well as overloaded
+ * <c>FromString()</c> and <c>operator>>()</c> functions for an
+ * <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be
+ * the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FROM_STRING_DEFINITION(Specifier,                     \
+                                         EnumName,                      \
+                                         ForeachInEnum)                 \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(Specifier,                  \
+                                            EnumName,                   \
+                                            ForeachInEnum)              \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(Specifier,                \
+                                              EnumName,                 \
+                                              ForeachInEnum)
+
+/**
+ * Internal macro for defining the <c>EnumName_FromString()</c>
+ * function as well as overloaded <c>FromString()</c> and
+ * <c>operator>>()</c> functions for an <c>enum class</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(Specifier,               \
+                                               EnumName,                \
+                                               ForeachInEnum)           \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(Specifier,                  \
+                                            EnumName,                   \
+                                            ForeachInEnum)              \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(Specifier,                \
+                                              EnumName,                 \
+                                              ForeachInEnum)
+#endif  /*  __cplusplus  */
+
+#if defined(__cplusplus) && MAKE_ENUM_CXX_STD >= 201402L
+/**
+ * Internal macro for defining the <c>EnumName_FromString()</c>
+ * function using a perfect hash that is built at compile time over
+ * the scoped and unscoped names of the elements.  A second perfect
+ * hash over the case-folded unscoped names makes
+ * <c>EnumName_FromStringCI()</c> O(1) too.  The table of elements
+ * must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  This works for both
+ * <c>enum</c> and <c>enum class</c> enumerations because the table
+ * holds the values of the elements.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_HASHED_FROM_STRING_DEFINITION_BASE_C(Specifier,       \
+                                                       EnumName,        \
+                                                       ForeachInEnum)   \
+    static constexpr auto EnumName##_MakeEnumHash =                     \
+        make_enum::detail::MakePerfectHash<                             \
+            2 * (sizeof(EnumName##_MakeEnumEntries)                     \
+                 / sizeof(EnumName##_MakeEnumEntries[0]))>(             \
+                     EnumName##_MakeEnumEntries);                       \
+                                                                        \
+    static constexpr auto EnumName##_MakeEnumHashIgnoreCase =           \
+        make_enum::detail::MakePerfectHash<                             \
+            (sizeof(EnumName##_MakeEnumEntries)                         \
+             / sizeof(EnumName##_MakeEnumEntries[0])),                  \
+            1,                                                          \
+            true>(EnumName##_MakeEnumEntries);                          \
+                                                                        \
+    MAKE_ENUM_INLINE const struct EnumName##_MakeEnumEntry*             \
+    EnumName##_MakeEnumFindIgnoreCase(const char* s,                    \
+                                      size_t n)                         \
+    {                                                                   \
+        return EnumName##_MakeEnumHashIgnoreCase.Find(                  \
+            EnumName##_MakeEnumEntries,                                 \
+            s,                                                          \
+            n);                                                         \
+    }                                                                   \
+                                                                        \
+    Specifier int                                                       \
+    EnumName##_FromString(enum EnumName* e,                             \
+                          const char* s)                                \
+    {                                                                   \
+        return EnumName##_FromStringN(e, s, s ? strlen(s) : 0);         \
+    }                                                                   \
+                                                                        \
+    Specifier int                                                       \
+    EnumName##_FromStringN(enum EnumName* e,                            \
+                           const char* s,                               \
+                           size_t n)                                    \
+    {                                                                   \
+        int result = 0;                                                 \
+        const struct EnumName##_MakeEnumEntry* entry = NULL;            \
+                                                                        \
+        if (!s || !e) {                                                 \
+            goto out;                                                   \
+        }                                                               \
+        entry = EnumName##_MakeEnumHash.Find(EnumName##_MakeEnumEntries, \
+                                             s,                         \
+                                             n);                        \
+        if (entry) {                                                    \
+            *e = entry->value;                                          \
+            result = 1;                                                 \
+            MAKE_ENUM_COUNT(EnumName,                                   \
+                            elements[entry - EnumName##_MakeEnumEntries] \
+                            .from_string);                              \
+        } else {                                                        \
+            MAKE_ENUM_COUNT(EnumName, from_string_misses.value);        \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    MAKE_ENUM_FROM_STRING_BATCH_DEFINITION(Specifier, EnumName)         \
+    MAKE_ENUM_DECODE_COLUMN_DEFINITION(Specifier, EnumName)             \
+    MAKE_ENUM_FROM_STRING_CI_DEFINITION(Specifier, EnumName)
+
+/**
+ * Internal macro for defining the <c>EnumName_FromString()</c>
+ * function using a perfect hash as well as overloaded
+ * <c>FromString()</c> and <c>operator>>()</c> functions for an
+ * <c>enum</c> or an <c>enum class</c>.  The table of elements must
+ * have already been defined by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_HASHED_FROM_STRING_DEFINITION(Specifier,              \
+                                                EnumName,               \
+                                                ForeachInEnum)          \
+    MAKE_ENUM_HASHED_FROM_STRING_DEFINITION_BASE_C(Specifier,           \
+                                                   EnumName,            \
+                                                   ForeachInEnum)       \
+    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(Specifier,                \
+                                              EnumName,                 \
+                                              ForeachInEnum)
+#endif  /*  __cplusplus && MAKE_ENUM_CXX_STD >= 201402L  */
+
+/************************************************************************
+ * IsValid() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+/**
+ * Internal macro for declaring the <c>EnumName_IsValid()</c>
+ * function.  <c>EnumName</c> should be the same as the values passed
+ * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_IS_VALID_DECLARATION_BASE(Specifier, EnumName) \
+    Specifier int                                                \
+    EnumName##_IsValid(enum EnumName e);
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring the
+ * <c>EnumName_IsValid()</c> function.  <c>EnumName</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_IS_VALID_DECLARATION(Specifier, EnumName) \
+    MAKE_ENUM_IS_VALID_DECLARATION_BASE(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_IsValid()</c> function and an overloaded
+ * <c>IsValid()</c> function.  <c>EnumName</c> should be the same as
+ * the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_IS_VALID_DECLARATION(Specifier, EnumName)  \
+    MAKE_ENUM_IS_VALID_DECLARATION_BASE(Specifier, EnumName) \
+                                                             \
+    Specifier bool                                           \
+    IsValid(EnumName e);
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_IsValid()</c> function
+ * for an <c>enum</c> or an <c>enum class</c>.  Both fast paths
+ * measure from the smallest value, not the first element, so they do
+ * not depend on the order the elements are declared in.  When the
+ * values of the elements are dense, validity is a single range check
+ * against the number of elements which is the largest value minus the
+ * smallest value plus one.  When they all fit in the bitmap generated
+ * by <c>MAKE_ENUM_BITMAP_DEFINITION()</c> which is defined here too,
+ * it is a range check and a bit test.  Otherwise, it falls back to
+ * <c>EnumName_MakeEnumIndexOf()</c> so <c>ForeachInEnum</c> is not
+ * expanded into a second <c>switch</c> statement.  The table of
+ * elements must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(Specifier,     \
+                                             EnumName,      \
+                                             ForeachInEnum) \
+    MAKE_ENUM_BITMAP_DEFINITION(EnumName, ForeachInEnum)    \
+                                                            \
+    Specifier int                                           \
+    EnumName##_IsValid(enum EnumName e)                     \
+    {                                                       \
+        int result = 0;                                     \
+        unsigned long offset =                              \
+            (unsigned long)e                                \
+            - (unsigned long)EnumName##_MakeEnumMin;        \
+        if (EnumName##_MakeEnumIsDense) {                   \
+            result = (offset                                \
+                      < (unsigned long)EnumName##_MakeEnumCount); \
+        } else if (EnumName##_MakeEnumIsCompact) {          \
+            result = ((offset < MAKE_ENUM_BITMAP_BITS) &&   \
+                      ((EnumName##_MakeEnumBitmap >> offset) & 1UL)); \
+        } else {                                            \
+            result = (EnumName##_MakeEnumIndexOf(e)         \
+                      < (size_t)EnumName##_MakeEnumCount);  \
+        }                                                   \
+        if (!result) {                                      \
+            MAKE_ENUM_COUNT(EnumName, is_valid_failures.value); \
+        }                                                   \
+        return result;                                      \
+    }
+
+#ifdef __cplusplus
+/**
+ * Internal macro for defining the overloaded <c>IsValid()</c>
+ * function for an <c>enum</c> or an <c>enum class</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>. <p>
+ *
+ * This macro works for both <c>enum</c> and <c>enum class</c>
+ * enumerations because the enum logic is in the
+ * <c>EnumName_FromString()</c> function which is defined
+ * elsewhere. <p>
+ */
+#define MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(Specifier,       \
+                                               EnumName,        \
+                                               ForeachInEnum)   \
+    Specifier bool                                              \
+    IsValid(EnumName e)                                         \
+    {                                                           \
+        return (bool)EnumName##_IsValid(e);                     \
+    }
+#endif
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for defining the
+ * <c>EnumName_IsValid()</c> function for an <c>enum</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_IS_VALID_DEFINITION(Specifier,                \
+                                      EnumName,                 \
+                                      ForeachInEnum)            \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(Specifier,             \
+                                         EnumName,              \
+                                         ForeachInEnum)
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_IsValid()</c> function as well as an overloaded
+ * <c>IsValid()</c> function for an <c>enum class</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_IS_VALID_DEFINITION(Specifier,                    \
+                                      EnumName,                     \
+                                      ForeachInEnum)                \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(Specifier,                 \
+                                         EnumName,                  \
+                                         ForeachInEnum)             \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(Specifier,               \
+                                           EnumName,                \
+                                           ForeachInEnum)
+
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_IsValid()</c> function as well as an overloaded
+ * <c>IsValid()</c> function for an <c>enum class</c>.
+ * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
+ * values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_IS_VALID_DEFINITION(Specifier,              \
+                                            EnumName,               \
+                                            ForeachInEnum)          \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(Specifier,                 \
+                                         EnumName,                  \
+                                         ForeachInEnum)             \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(Specifier,               \
+                                           EnumName,                \
+                                           ForeachInEnum)
 #endif  /*  __cplusplus  */
 
+/************************************************************************
+ * ToIndex() -- You should not need to use these macros directly.
+ ************************************************************************/
+
 /**
- * Internal macro for defining the <c>EnumName_FromString()</c>
- * function for an <c>enum</c>.  <c>EnumName</c> and
+ * Internal macro for declaring the <c>EnumName_ToIndex()</c> and
+ * <c>EnumName_FromIndex()</c> functions.  <c>EnumName</c> should be
+ * the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_INDEX_DECLARATION_BASE(Specifier, EnumName) \
+    Specifier size_t                                             \
+    EnumName##_ToIndex(enum EnumName e);                         \
+                                                                 \
+    Specifier int                                                \
+    EnumName##_FromIndex(enum EnumName* e,                       \
+                         size_t i);
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring the
+ * <c>EnumName_ToIndex()</c> and <c>EnumName_FromIndex()</c>
+ * functions.  <c>EnumName</c> should be the same as the values passed
+ * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_INDEX_DECLARATION(Specifier, EnumName) \
+    MAKE_ENUM_TO_INDEX_DECLARATION_BASE(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_ToIndex()</c> and <c>EnumName_FromIndex()</c>
+ * functions as well as overloaded <c>ToIndex()</c> and
+ * <c>FromIndex()</c> functions.  <c>EnumName</c> should be the same
+ * as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_TO_INDEX_DECLARATION(Specifier, EnumName)  \
+    MAKE_ENUM_TO_INDEX_DECLARATION_BASE(Specifier, EnumName) \
+                                                             \
+    Specifier size_t                                         \
+    ToIndex(EnumName e);                                     \
+                                                             \
+    Specifier bool                                           \
+    FromIndex(EnumName& e,                                   \
+              size_t i);
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_ToIndex()</c> and
+ * <c>EnumName_FromIndex()</c> functions for an <c>enum</c> or an
+ * <c>enum class</c>.  The index of an element is its position in
+ * <c>ForeachInEnum</c>, so it maps the elements one-to-one onto
+ * <c>[0, EnumName_MakeEnumCount)</c> no matter how sparse their
+ * values are.  The table of elements must have already been defined
+ * by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.  <c>EnumName</c> and
  * <c>ForeachInEnum</c> should be the same as the values passed into
- * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
- * @param X macro to apply to each element
  */
-#define MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(EnumName,       \
-                                                ForeachInEnum,  \
-                                                X)              \
-    int                                                         \
-    EnumName##_FromString(enum EnumName* e,                     \
-                          const char* s)                        \
-    {                                                           \
-        int result = 0;                                         \
+#define MAKE_ENUM_TO_INDEX_DEFINITION_BASE_C(Specifier,             \
+                                             EnumName,              \
+                                             ForeachInEnum)         \
+    Specifier size_t                                                \
+    EnumName##_ToIndex(enum EnumName e)                             \
+    {                                                               \
+        size_t result = EnumName##_MakeEnumIndexOf(e);              \
+        if (result > (size_t)EnumName##_MakeEnumCount) {            \
+            result = (size_t)EnumName##_MakeEnumCount;              \
+        }                                                           \
+        return result;                                              \
+    }                                                               \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FromIndex(enum EnumName* e,                          \
+                         size_t i)                                  \
+    {                                                               \
+        int result = 0;                                             \
+        if (e && (i < (size_t)EnumName##_MakeEnumCount)) {          \
+            *e = EnumName##_MakeEnumEntries[i].value;               \
+            result = 1;                                             \
+        }                                                           \
+        return result;                                              \
+    }
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for defining the
+ * <c>EnumName_ToIndex()</c> and <c>EnumName_FromIndex()</c>
+ * functions.  <c>EnumName</c> and <c>ForeachInEnum</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_INDEX_DEFINITION(Specifier,                    \
+                                      EnumName,                     \
+                                      ForeachInEnum)                \
+    MAKE_ENUM_TO_INDEX_DEFINITION_BASE_C(Specifier,                 \
+                                         EnumName,                  \
+                                         ForeachInEnum)
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_ToIndex()</c> and <c>EnumName_FromIndex()</c>
+ * functions as well as overloaded <c>ToIndex()</c> and
+ * <c>FromIndex()</c> functions.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_TO_INDEX_DEFINITION(Specifier,                    \
+                                      EnumName,                     \
+                                      ForeachInEnum)                \
+    MAKE_ENUM_TO_INDEX_DEFINITION_BASE_C(Specifier,                 \
+                                         EnumName,                  \
+                                         ForeachInEnum)             \
+                                                                    \
+    Specifier size_t                                                \
+    ToIndex(EnumName e)                                             \
+    {                                                               \
+        return EnumName##_ToIndex(e);                               \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FromIndex(EnumName& e,                                          \
+              size_t i)                                             \
+    {                                                               \
+        return (bool)EnumName##_FromIndex(&e, i);                   \
+    }
+#endif  /*  __cplusplus  */
+
+/************************************************************************
+ * Encode() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+/**
+ * Internal macro for declaring the <c>EnumName_Encode()</c>,
+ * <c>EnumName_Decode()</c>, <c>EnumName_PackedSize()</c>,
+ * <c>EnumName_Pack()</c>, and <c>EnumName_Unpack()</c> functions.
+ * <c>EnumName</c> should be the same as the values passed into the
+ * corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DECLARATION_BASE(Specifier, EnumName)  \
+    Specifier size_t                                            \
+    EnumName##_Encode(unsigned char* buf,                       \
+                      size_t size,                              \
+                      enum EnumName e);                         \
                                                                 \
-        if (!s || !e) {                                         \
-            goto out;                                           \
-        }                                                       \
-        ForeachInEnum(EnumName, X)                              \
+    Specifier size_t                                            \
+    EnumName##_Decode(enum EnumName* e,                         \
+                      const unsigned char* buf,                 \
+                      size_t size);                             \
                                                                 \
-     out:                                                       \
-        return result;                                          \
+    Specifier size_t                                            \
+    EnumName##_PackedSize(size_t count);                        \
+                                                                \
+    Specifier size_t                                            \
+    EnumName##_Pack(unsigned char* buf,                         \
+                    size_t size,                                \
+                    const enum EnumName* e,                     \
+                    size_t count);                              \
+                                                                \
+    Specifier size_t                                            \
+    EnumName##_Unpack(enum EnumName* e,                         \
+                      size_t count,                             \
+                      const unsigned char* buf,                 \
+                      size_t size);
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring the
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions.  <c>EnumName</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DECLARATION(Specifier, EnumName) \
+    MAKE_ENUM_ENCODE_DECLARATION_BASE(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for declaring the
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions as well as overloaded
+ * <c>Encode()</c>, <c>Decode()</c>, <c>Pack()</c>, and
+ * <c>Unpack()</c> functions.  <c>EnumName</c> should be the same as
+ * the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DECLARATION(Specifier, EnumName)   \
+    MAKE_ENUM_ENCODE_DECLARATION_BASE(Specifier, EnumName)  \
+                                                            \
+    Specifier size_t                                        \
+    Encode(unsigned char* buf,                              \
+           size_t size,                                     \
+           EnumName e);                                     \
+                                                            \
+    Specifier size_t                                        \
+    Decode(EnumName& e,                                     \
+           const unsigned char* buf,                        \
+           size_t size);                                    \
+                                                            \
+    Specifier size_t                                        \
+    Pack(unsigned char* buf,                                \
+         size_t size,                                       \
+         const EnumName* e,                                 \
+         size_t count);                                     \
+                                                            \
+    Specifier size_t                                        \
+    Unpack(EnumName* e,                                     \
+           size_t count,                                    \
+           const unsigned char* buf,                        \
+           size_t size);
+#endif
+
+/**
+ * Internal macro for defining the <c>EnumName_Encode()</c>,
+ * <c>EnumName_Decode()</c>, <c>EnumName_PackedSize()</c>,
+ * <c>EnumName_Pack()</c>, and <c>EnumName_Unpack()</c> functions for
+ * an <c>enum</c> or an <c>enum class</c>.  Elements are stored as
+ * their index instead of their value, so every element of a sparse
+ * enumeration fits in one varint byte if it has at most 128 elements,
+ * and a packed array needs only <c>EnumName_MakeEnumBits</c> bits per
+ * element.  Decoding checks each index against
+ * <c>EnumName_MakeEnumCount</c> and loads the element from the table
+ * of elements, so it is O(1) and never yields an invalid element.
+ * The varint is little endian base 128 and is rejected if it is
+ * longer than an index can be.  Packed indexes are stored least
+ * significant bit first.  The table of elements must have already
+ * been defined by <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)         \
+    Specifier size_t                                                    \
+    EnumName##_Encode(unsigned char* buf,                               \
+                      size_t size,                                      \
+                      enum EnumName e)                                  \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t i = EnumName##_MakeEnumIndexOf(e);                       \
+                                                                        \
+        if (!buf || (i >= (size_t)EnumName##_MakeEnumCount)) {          \
+            goto out;                                                   \
+        }                                                               \
+        do {                                                            \
+            if (result == size) {                                       \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            buf[result++] = (unsigned char)((i & 0x7f)                  \
+                                            | ((i > 0x7f) ? 0x80 : 0)); \
+            i >>= 7;                                                    \
+        } while (i);                                                    \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Decode(enum EnumName* e,                                 \
+                      const unsigned char* buf,                         \
+                      size_t size)                                      \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t i = 0;                                                   \
+        unsigned char byte = 0;                                         \
+                                                                        \
+        if (!e || !buf) {                                               \
+            goto out;                                                   \
+        }                                                               \
+        do {                                                            \
+            if ((result == size) ||                                     \
+                (result == (size_t)(EnumName##_MakeEnumBits + 6) / 7))  \
+            {                                                           \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            byte = buf[result];                                         \
+            i |= (size_t)(byte & 0x7f) << (7 * result);                 \
+            ++result;                                                   \
+        } while (byte & 0x80);                                          \
+        if (i >= (size_t)EnumName##_MakeEnumCount) {                    \
+            result = 0;                                                 \
+            goto out;                                                   \
+        }                                                               \
+        *e = EnumName##_MakeEnumEntries[i].value;                       \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_PackedSize(size_t count)                                 \
+    {                                                                   \
+        return (count * (size_t)EnumName##_MakeEnumBits + 7) / 8;       \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Pack(unsigned char* buf,                                 \
+                    size_t size,                                        \
+                    const enum EnumName* e,                             \
+                    size_t count)                                       \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t i = 0;                                                   \
+        size_t index = 0;                                               \
+        unsigned long acc = 0;                                          \
+        unsigned int acc_bits = 0;                                      \
+                                                                        \
+        if (!buf || !e || (size < EnumName##_PackedSize(count))) {      \
+            goto out;                                                   \
+        }                                                               \
+        for (i = 0; i < count; ++i) {                                   \
+            index = EnumName##_MakeEnumIndexOf(e[i]);                   \
+            if (index >= (size_t)EnumName##_MakeEnumCount) {            \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            acc |= (unsigned long)index << acc_bits;                    \
+            acc_bits += (unsigned int)EnumName##_MakeEnumBits;          \
+            while (acc_bits >= 8) {                                     \
+                buf[result++] = (unsigned char)acc;                     \
+                acc >>= 8;                                              \
+                acc_bits -= 8;                                          \
+            }                                                           \
+        }                                                               \
+        if (acc_bits > 0) {                                             \
+            buf[result++] = (unsigned char)acc;                         \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Unpack(enum EnumName* e,                                 \
+                      size_t count,                                     \
+                      const unsigned char* buf,                         \
+                      size_t size)                                      \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t pos = 0;                                                 \
+        size_t index = 0;                                               \
+        unsigned long acc = 0;                                          \
+        unsigned int acc_bits = 0;                                      \
+                                                                        \
+        if (!e || !buf) {                                               \
+            goto out;                                                   \
+        }                                                               \
+        for (result = 0; result < count; ++result) {                    \
+            while (acc_bits < (unsigned int)EnumName##_MakeEnumBits) {  \
+                if (pos == size) {                                      \
+                    goto out;                                           \
+                }                                                       \
+                acc |= (unsigned long)buf[pos++] << acc_bits;           \
+                acc_bits += 8;                                          \
+            }                                                           \
+            index = (size_t)(acc                                        \
+                             & ((1UL << EnumName##_MakeEnumBits) - 1)); \
+            acc >>= EnumName##_MakeEnumBits;                            \
+            acc_bits -= (unsigned int)EnumName##_MakeEnumBits;          \
+            if (index >= (size_t)EnumName##_MakeEnumCount) {            \
+                goto out;                                               \
+            }                                                           \
+            e[result] = EnumName##_MakeEnumEntries[index].value;        \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
     }
 
 #ifdef __cplusplus
 /**
- * Internal macro for defining the overloaded <c>FromString()</c> and
- * <c>operator>>()</c> functions for an <c>enum</c> or an <c>enum
- * class</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be the
- * same as the values passed into the corresponding call to
+ * Internal macro for defining the overloaded <c>Encode()</c>,
+ * <c>Decode()</c>, <c>Pack()</c>, and <c>Unpack()</c> functions of
+ * an <c>enum</c> or an <c>enum class</c> which forward to the
+ * corresponding C functions.  <c>EnumName</c> should be the same as
+ * the values passed into the corresponding call to
  * <c>MAKE_ENUM_DECLARATION()</c> or
- * <c>MAKE_ENUM_CLASSDECLARATION()</c>. <p>
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
  *
- * This macro works for both <c>enum</c> and <c>enum class</c>
- * enumerations because the enum logic is in the
- * <c>EnumName_FromString()</c> function which is defined
- * elsewhere. <p>
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
  */
-#define MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(EnumName,         \
-                                                  ForeachInEnum)    \
-    bool                                                            \
-    FromString(EnumName& e,                                         \
-               const std::string& s)                                \
+#define MAKE_ENUM_ENCODE_DEFINITION_BASE_CXX(Specifier, EnumName)   \
+    Specifier size_t                                                \
+    Encode(unsigned char* buf,                                      \
+           size_t size,                                             \
+           EnumName e)                                              \
     {                                                               \
-        return (bool)EnumName##_FromString(&e, s.c_str());          \
+        return EnumName##_Encode(buf, size, e);                     \
     }                                                               \
                                                                     \
-    std::istream&                                                   \
-    operator>>(std::istream& istrm,                                 \
-               EnumName& e)                                         \
+    Specifier size_t                                                \
+    Decode(EnumName& e,                                             \
+           const unsigned char* buf,                                \
+           size_t size)                                             \
     {                                                               \
-        std::string token;                                          \
-        istrm >> token;                                             \
-        if (!FromString(e, token)) {                                \
-            istrm.setstate(std::ios::failbit);                      \
-        }                                                           \
-        return istrm;                                               \
+        return EnumName##_Decode(&e, buf, size);                    \
+    }                                                               \
+                                                                    \
+    Specifier size_t                                                \
+    Pack(unsigned char* buf,                                        \
+         size_t size,                                               \
+         const EnumName* e,                                         \
+         size_t count)                                              \
+    {                                                               \
+        return EnumName##_Pack(buf, size, e, count);                \
+    }                                                               \
+                                                                    \
+    Specifier size_t                                                \
+    Unpack(EnumName* e,                                             \
+           size_t count,                                            \
+           const unsigned char* buf,                                \
+           size_t size)                                             \
+    {                                                               \
+        return EnumName##_Unpack(e, count, buf, size);              \
     }
-#endif
+#endif  /*  __cplusplus  */
 
 #ifndef __cplusplus
 /**
  * C version of internal macro for defining the
- * <c>EnumName_FromString()</c> function for an <c>enum</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions.  <c>EnumName</c> should be the
+ * same as the values passed into the corresponding call to
  * <c>MAKE_ENUM_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DEFINITION(Specifier, EnumName)    \
+    MAKE_ENUM_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions as well as overloaded
+ * <c>Encode()</c>, <c>Decode()</c>, <c>Pack()</c>, and
+ * <c>Unpack()</c> functions.  <c>EnumName</c> should be the same as
+ * the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_ENCODE_DEFINITION(Specifier, EnumName)        \
+    MAKE_ENUM_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)     \
+    MAKE_ENUM_ENCODE_DEFINITION_BASE_CXX(Specifier, EnumName)
+#endif  /*  __cplusplus  */
+
+/************************************************************************
+ * SchemaHash() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+#if !defined(__cplusplus) || MAKE_ENUM_CXX_STD < 201402L
+/**
+ * C and C++11 version of internal macro for declaring the
+ * <c>EnumName_SchemaHash()</c> function.  <c>EnumName</c> should be
+ * the same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_SCHEMA_HASH_DECLARATION(Specifier, EnumName) \
+    Specifier MakeEnum_Uint64                                  \
+    EnumName##_SchemaHash(void);
+
+/**
+ * C and C++11 version of internal macro for defining the
+ * <c>EnumName_SchemaHash()</c> function which hashes the names and
+ * values in the table of elements at run time.  The table of elements
+ * must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_SCHEMA_HASH_DEFINITION(Specifier, EnumName)           \
+    Specifier MakeEnum_Uint64                                           \
+    EnumName##_SchemaHash(void)                                         \
+    {                                                                   \
+        MakeEnum_Uint64 result = MAKE_ENUM_SCHEMA_HASH_BASIS;           \
+        size_t i = 0;                                                   \
+                                                                        \
+        for (i = 0; i < (size_t)EnumName##_MakeEnumCount; ++i) {        \
+            result = MakeEnum_SchemaHashStep(                           \
+                result,                                                 \
+                EnumName##_MakeEnumEntries[i].name,                     \
+                MAKE_ENUM_SCHEMA_HASH_VALUE(                            \
+                    EnumName##_MakeEnumEntries[i].value));              \
+        }                                                               \
+        return result;                                                  \
+    }
+#else
+/**
+ * C++14 version of internal macro for declaring and defining the
+ * <c>EnumName_SchemaHash()</c> function.  It is <c>constexpr</c> and
+ * hashes the names and values held by
+ * <c>make_enum::EnumTraits<EnumName></c>, so it can be evaluated at
+ * compile time, but it is only evaluated if it is called.
+ *
+ * @param Specifier storage class specifier for the helper functions (not used)
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_SCHEMA_HASH_DECLARATION(Specifier, EnumName)  \
+    constexpr MakeEnum_Uint64                                   \
+    EnumName##_SchemaHash()                                     \
+    {                                                           \
+        return make_enum::detail::SchemaHash(                   \
+            EnumName##_MakeEnumInfo<>::names,                   \
+            EnumName##_MakeEnumInfo<>::values,                  \
+            EnumName##_MakeEnumCount);                          \
+    }
+
+/**
+ * C++14 version of internal macro that defines nothing because
+ * <c>EnumName_SchemaHash()</c> is defined by the declaration.
+ *
+ * @param Specifier storage class specifier for the helper functions (not used)
+ * @param EnumName enumeration name (not used)
+ */
+#define MAKE_ENUM_SCHEMA_HASH_DEFINITION(Specifier, EnumName)
+#endif  /*  !__cplusplus || MAKE_ENUM_CXX_STD < 201402L  */
+
+/************************************************************************
+ * Usage() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+#ifdef MAKE_ENUM_INSTRUMENTED
+/**
+ * Internal macro for declaring the <c>EnumName_Usage</c> structure
+ * along with the <c>EnumName_UsageSnapshot()</c>,
+ * <c>EnumName_UsageReset()</c>, and <c>EnumName_UsageDump()</c>
+ * functions for an <c>enum</c> or an <c>enum class</c>.  The arrays
+ * in <c>EnumName_Usage</c> are indexed by <c>EnumName_ToIndex()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_USAGE_DECLARATION(Specifier, EnumName)    \
+    struct EnumName##_Usage {                               \
+        size_t from_string[EnumName##_MakeEnumCount];       \
+        size_t to_string[EnumName##_MakeEnumCount];         \
+        size_t from_string_misses;                          \
+        size_t is_valid_failures;                           \
+    };                                                      \
+                                                            \
+    Specifier void                                          \
+    EnumName##_UsageSnapshot(struct EnumName##_Usage* usage); \
+                                                            \
+    Specifier void                                          \
+    EnumName##_UsageReset(void);                            \
+                                                            \
+    Specifier void                                          \
+    EnumName##_UsageDump(FILE* f);
+
+/**
+ * Internal macro for defining the <c>EnumName_UsageSnapshot()</c>,
+ * <c>EnumName_UsageReset()</c>, and <c>EnumName_UsageDump()</c>
+ * functions for an <c>enum</c> or an <c>enum class</c>.  Each counter
+ * is read with a relaxed load, so a snapshot taken while other
+ * threads are converting elements is not a consistent view of all of
+ * the counters at one instant, but no increment is ever lost.  The
+ * counters must have already been defined by
+ * <c>MAKE_ENUM_TABLE_DEFINITION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_USAGE_DEFINITION(Specifier, EnumName)                 \
+    Specifier void                                                      \
+    EnumName##_UsageSnapshot(struct EnumName##_Usage* usage)            \
+    {                                                                   \
+        size_t i = 0;                                                   \
+                                                                        \
+        for (i = 0; i < (size_t)EnumName##_MakeEnumCount; ++i) {        \
+            usage->from_string[i] = MAKE_ENUM_COUNTER_LOAD(             \
+                EnumName##_MakeEnumUsageCounters.elements[i].from_string); \
+            usage->to_string[i] = MAKE_ENUM_COUNTER_LOAD(               \
+                EnumName##_MakeEnumUsageCounters.elements[i].to_string); \
+        }                                                               \
+        usage->from_string_misses = MAKE_ENUM_COUNTER_LOAD(             \
+            EnumName##_MakeEnumUsageCounters.from_string_misses.value); \
+        usage->is_valid_failures = MAKE_ENUM_COUNTER_LOAD(              \
+            EnumName##_MakeEnumUsageCounters.is_valid_failures.value);  \
+    }                                                                   \
+                                                                        \
+    Specifier void                                                      \
+    EnumName##_UsageReset(void)                                         \
+    {                                                                   \
+        size_t i = 0;                                                   \
+                                                                        \
+        for (i = 0; i < (size_t)EnumName##_MakeEnumCount; ++i) {        \
+            MAKE_ENUM_COUNTER_RESET(                                    \
+                EnumName##_MakeEnumUsageCounters.elements[i].from_string); \
+            MAKE_ENUM_COUNTER_RESET(                                    \
+                EnumName##_MakeEnumUsageCounters.elements[i].to_string); \
+        }                                                               \
+        MAKE_ENUM_COUNTER_RESET(                                        \
+            EnumName##_MakeEnumUsageCounters.from_string_misses.value); \
+        MAKE_ENUM_COUNTER_RESET(                                        \
+            EnumName##_MakeEnumUsageCounters.is_valid_failures.value);  \
+    }                                                                   \
+                                                                        \
+    Specifier void                                                      \
+    EnumName##_UsageDump(FILE* f)                                       \
+    {                                                                   \
+        struct EnumName##_Usage usage;                                  \
+        size_t i = 0;                                                   \
+                                                                        \
+        EnumName##_UsageSnapshot(&usage);                               \
+        for (i = 0; i < (size_t)EnumName##_MakeEnumCount; ++i) {        \
+            fprintf(f,                                                  \
+                    "%s from_string=%lu to_string=%lu\n",               \
+                    EnumName##_MakeEnumEntries[i].qualified_name,       \
+                    (unsigned long)usage.from_string[i],                \
+                    (unsigned long)usage.to_string[i]);                 \
+        }                                                               \
+        fprintf(f,                                                      \
+                "%s from_string_misses=%lu is_valid_failures=%lu\n",    \
+                #EnumName,                                              \
+                (unsigned long)usage.from_string_misses,                \
+                (unsigned long)usage.is_valid_failures);                \
+    }
+#else
+/**
+ * Internal macro that declares nothing because
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is not defined.
+ *
+ * @param Specifier storage class specifier for the helper functions (not used)
+ * @param EnumName enumeration name (not used)
+ */
+#define MAKE_ENUM_USAGE_DECLARATION(Specifier, EnumName)
+
+/**
+ * Internal macro that defines nothing because
+ * <c>MAKE_ENUM_INSTRUMENTED</c> is not defined.
+ *
+ * @param Specifier storage class specifier for the helper functions (not used)
+ * @param EnumName enumeration name (not used)
+ */
+#define MAKE_ENUM_USAGE_DEFINITION(Specifier, EnumName)
+#endif  /*  MAKE_ENUM_INSTRUMENTED  */
+
+/************************************************************************
+ * Flags() -- You should not need to use these macros directly.
+ ************************************************************************/
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for the index of the lowest bit that is
+ * set in the <c>unsigned long</c> <c>x</c> which must not be zero.
+ *
+ * @param x value to measure
+ */
+#define MAKE_ENUM_COUNT_TRAILING_ZEROS(x) MakeEnum_CountTrailingZeros(x)
+#else
+/**
+ * C++ version of internal macro for the index of the lowest bit that
+ * is set in the <c>unsigned long</c> <c>x</c> which must not be zero.
+ *
+ * @param x value to measure
+ */
+#define MAKE_ENUM_COUNT_TRAILING_ZEROS(x)       \
+    make_enum::detail::CountTrailingZeros(x)
+#endif  /*  __cplusplus  */
+
+/**
+ * Internal X macro for adding the bits of the enumeration element
+ * <c>ElementName</c> to the mask of a flag enumeration.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_MASK(EnumName,                                  \
+                         ElementName,                               \
+                         ElementValue)                              \
+    | (unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName)
+
+/**
+ * Internal X macro for adding the bits of the enumeration element
+ * <c>ElementName</c> to the mask of the elements of a flag
+ * enumeration that have more than one bit set.
+ *
+ * @param EnumName enumeration name
+ * @param ElementName enumeration element name
+ * @param ElementValue enumeration element element (not used)
+ */
+#define X_MAKE_ENUM_MULTI_BIT_MASK(EnumName,                        \
+                                   ElementName,                     \
+                                   ElementValue)                    \
+    | ((((unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) \
+         & ((unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName,       \
+                                                    ElementName)    \
+            - 1UL)) != 0)                                           \
+       ? (unsigned long)MAKE_ENUM_SCOPED_ELEMENT(EnumName, ElementName) \
+       : 0UL)
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for declaring
+ * <c>EnumName_MakeEnumMask</c> and
+ * <c>EnumName_MakeEnumMultiBitMask</c>.  It is empty because C cannot
+ * use the masks in the header.  See
+ * <c>MAKE_ENUM_MASK_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_MASK_DECLARATION(EnumName)
+
+/**
+ * C version of internal macro for defining
+ * <c>EnumName_MakeEnumMask</c> which is the bitwise OR of the values
+ * of every element and <c>EnumName_MakeEnumMultiBitMask</c> which is
+ * the bitwise OR of the values of the elements that have more than
+ * one bit set.  They are defined in the source file because they are
+ * not <c>int</c> so they cannot be enumeration constants.
+ *
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
- * @param X macro to apply to each element
  */
-#define MAKE_ENUM_FROM_STRING_DEFINITION(EnumName,                      \
-                                         ForeachInEnum)                 \
-    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(EnumName,                   \
-                                            ForeachInEnum,              \
-                                            X_MAKE_ENUM_FROM_STRING)
+#define MAKE_ENUM_MASK_DEFINITION(EnumName, ForeachInEnum)          \
+    static const unsigned long EnumName##_MakeEnumMask =            \
+        0UL ForeachInEnum(EnumName, X_MAKE_ENUM_MASK);              \
+                                                                    \
+    static const unsigned long EnumName##_MakeEnumMultiBitMask =    \
+        0UL ForeachInEnum(EnumName, X_MAKE_ENUM_MULTI_BIT_MASK);
 #else
 /**
- * C++ version of internal macro for defining the
- * <c>EnumName_FromString()</c> function as well as overloaded
- * <c>FromString()</c> and <c>operator>>()</c> functions for an
- * <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c> should be
- * the same as the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * C++ version of internal macro for declaring
+ * <c>EnumName_MakeEnumMask</c> which is the bitwise OR of the values
+ * of every element and <c>EnumName_MakeEnumMultiBitMask</c> which is
+ * the bitwise OR of the values of the elements that have more than
+ * one bit set.  They are declared in the header so the
+ * <c>constexpr</c> bitwise operators can use them.
  *
  * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
- * @param X macro to apply to each element
  */
-#define MAKE_ENUM_FROM_STRING_DEFINITION(EnumName,                      \
-                                         ForeachInEnum)                 \
-    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(EnumName,                   \
-                                            ForeachInEnum,              \
-                                            X_MAKE_ENUM_FROM_STRING)    \
-    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
+#define MAKE_ENUM_MASK_DECLARATION(EnumName)                        \
+    static constexpr unsigned long EnumName##_MakeEnumMask =        \
+        make_enum::detail::Mask(EnumName##_MakeEnumValues,          \
+                                0,                                  \
+                                EnumName##_MakeEnumCount);          \
+                                                                    \
+    static constexpr unsigned long EnumName##_MakeEnumMultiBitMask = \
+        make_enum::detail::MultiBitMask(EnumName##_MakeEnumValues,  \
+                                        0,                          \
+                                        EnumName##_MakeEnumCount);
 
 /**
- * Internal macro for defining the <c>EnumName_FromString()</c>
- * function as well as overloaded <c>FromString()</c> and
- * <c>operator>>()</c> functions for an <c>enum class</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * C++ version of internal macro for defining
+ * <c>EnumName_MakeEnumMask</c> and
+ * <c>EnumName_MakeEnumMultiBitMask</c>.  It is empty because the
+ * masks were declared by <c>MAKE_ENUM_MASK_DECLARATION()</c>.
  *
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(EnumName,                   \
-                                               ForeachInEnum)              \
-    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_C(EnumName,                      \
-                                            ForeachInEnum,                 \
-                                            X_MAKE_ENUM_CLASS_FROM_STRING) \
-    MAKE_ENUM_FROM_STRING_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
+#define MAKE_ENUM_MASK_DEFINITION(EnumName, ForeachInEnum)
 #endif  /*  __cplusplus  */
 
-/************************************************************************
- * IsValid() -- You should not need to use these macros directly.
- ************************************************************************/
-
 /**
- * Internal macro for declaring the <c>EnumName_IsValid()</c>
- * function.  <c>EnumName</c> should be the same as the values passed
- * into the corresponding call to <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal macro for declaring the <c>EnumName_FlagsToString()</c>,
+ * <c>EnumName_FlagsFromString()</c>, and
+ * <c>EnumName_FlagsFromStringN()</c> functions.  <c>EnumName</c>
+ * should be the same as the values passed into the corresponding call
+ * to <c>MAKE_ENUM_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
  */
-#define MAKE_ENUM_IS_VALID_DECLARATION_BASE(EnumName)   \
-    int                                                 \
-    EnumName##_IsValid(enum EnumName e);
+#define MAKE_ENUM_FLAGS_DECLARATION_BASE(Specifier, EnumName)      \
+    MAKE_ENUM_MASK_DECLARATION(EnumName)                            \
+                                                                    \
+    Specifier size_t                                                \
+    EnumName##_FlagsToString(char* buf,                             \
+                             size_t size,                           \
+                             enum EnumName e,                       \
+                             int with_enum_name);                   \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FlagsFromString(enum EnumName* e,                    \
+                               const char* s);                      \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FlagsFromStringN(enum EnumName* e,                   \
+                                const char* s,                      \
+                                size_t n);
 
 #ifndef __cplusplus
 /**
- * C version of internal macro for declaring the
- * <c>EnumName_IsValid()</c> function.  <c>EnumName</c> should be the
- * same as the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * C version of internal macro for declaring the flag helper
+ * functions.  <c>EnumName</c> should be the same as the values passed
+ * into the corresponding call to
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
+ * @param DefaultWithEnumName default value for <c>with_enum_name</c> (not used)
  */
-#define MAKE_ENUM_IS_VALID_DECLARATION(EnumName)   \
-    MAKE_ENUM_IS_VALID_DECLARATION_BASE(EnumName)
+#define MAKE_ENUM_FLAGS_DECLARATION_HELPERS(Specifier,              \
+                                            EnumName,               \
+                                            DefaultWithEnumName)    \
+    MAKE_ENUM_FLAGS_DECLARATION_BASE(Specifier, EnumName)
 #else
 /**
- * C++ version of internal macro for declaring the
- * <c>EnumName_IsValid()</c> function and an overloaded
- * <c>IsValid()</c> function.  <c>EnumName</c> should be the same as
- * the values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * C++ version of internal macro for declaring the flag helper
+ * functions along with overloaded <c>FlagsToString()</c> and
+ * <c>FlagsFromString()</c> functions and the bitwise operators.  The
+ * operators are <c>constexpr</c> and keep their results inside the
+ * type so <c>A | B</c> is an <c>EnumName</c> for both <c>enum</c>
+ * and <c>enum class</c>.  <c>operator~()</c> only flips the bits in
+ * <c>EnumName_MakeEnumMask</c> so its result stays valid.
+ * <c>EnumName</c> should be the same as the values passed into the
+ * corresponding call to <c>MAKE_ENUM_FLAGS_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
+ * @param DefaultWithEnumName default value for <c>with_enum_name</c>
  */
-#define MAKE_ENUM_IS_VALID_DECLARATION(EnumName)   \
-    MAKE_ENUM_IS_VALID_DECLARATION_BASE(EnumName)  \
-                                                   \
-    bool                                           \
-    IsValid(EnumName e);
-#endif
+#define MAKE_ENUM_FLAGS_DECLARATION_HELPERS(Specifier,                  \
+                                            EnumName,                   \
+                                            DefaultWithEnumName)        \
+    MAKE_ENUM_FLAGS_DECLARATION_BASE(Specifier, EnumName)               \
+                                                                        \
+    constexpr EnumName                                                  \
+    operator|(EnumName a,                                               \
+              EnumName b)                                               \
+    {                                                                   \
+        return (EnumName)((unsigned long)a | (unsigned long)b);         \
+    }                                                                   \
+                                                                        \
+    constexpr EnumName                                                  \
+    operator&(EnumName a,                                               \
+              EnumName b)                                               \
+    {                                                                   \
+        return (EnumName)((unsigned long)a & (unsigned long)b);         \
+    }                                                                   \
+                                                                        \
+    constexpr EnumName                                                  \
+    operator^(EnumName a,                                               \
+              EnumName b)                                               \
+    {                                                                   \
+        return (EnumName)((unsigned long)a ^ (unsigned long)b);         \
+    }                                                                   \
+                                                                        \
+    constexpr EnumName                                                  \
+    operator~(EnumName a)                                               \
+    {                                                                   \
+        return (EnumName)(~(unsigned long)a & EnumName##_MakeEnumMask); \
+    }                                                                   \
+                                                                        \
+    inline EnumName&                                                    \
+    operator|=(EnumName& a,                                             \
+               EnumName b)                                              \
+    {                                                                   \
+        return a = a | b;                                               \
+    }                                                                   \
+                                                                        \
+    inline EnumName&                                                    \
+    operator&=(EnumName& a,                                             \
+               EnumName b)                                              \
+    {                                                                   \
+        return a = a & b;                                               \
+    }                                                                   \
+                                                                        \
+    inline EnumName&                                                    \
+    operator^=(EnumName& a,                                             \
+               EnumName b)                                              \
+    {                                                                   \
+        return a = a ^ b;                                               \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    FlagsToString(char* buf,                                            \
+                  size_t size,                                          \
+                  EnumName e,                                           \
+                  bool with_enum_name = DefaultWithEnumName);           \
+                                                                        \
+    Specifier bool                                                      \
+    FlagsFromString(EnumName& e,                                        \
+                    const std::string& s);                              \
+                                                                        \
+    Specifier bool                                                      \
+    FlagsFromString(EnumName& e,                                        \
+                    const char* s);                                     \
+                                                                        \
+    MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName)
 
+#if MAKE_ENUM_CXX_STD >= 201703L
 /**
- * Internal X macro for determining if the value of the enumeration
- * maps to an enumeration element.
+ * C++17 version of internal macro for declaring the overloaded
+ * <c>FlagsFromString()</c> function that parses a
+ * <c>std::string_view</c>.
  *
- * @param EnumName enumeration name (not used)
- * @param ElementName enumeration element name
- * @param ElementValue enumeration element element (not used)
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
  */
-#define X_MAKE_ENUM_IS_VALID(EnumName,          \
-                             ElementName,       \
-                             ElementValue)      \
-    case ElementName:
-
-#ifdef __cplusplus
+#define MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName) \
+    Specifier bool                                                      \
+    FlagsFromString(EnumName& e,                                        \
+                    std::string_view s);
+#else
 /**
- * Internal X macro for determining if the value of the scoped
- * enumeration maps to an enumeration element.
+ * Pre-C++17 version of internal macro for declaring the overloaded
+ * <c>FlagsFromString()</c> function that parses a
+ * <c>std::string_view</c>.  It is empty because
+ * <c>std::string_view</c> requires C++17.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
- * @param ElementName enumeration element name
- * @param ElementValue enumeration element element (not used)
  */
-#define X_MAKE_ENUM_CLASS_IS_VALID(EnumName,        \
-                                   ElementName,     \
-                                   ElementValue)    \
-    case EnumName::ElementName:
+#define MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DECLARATION(Specifier, EnumName)
+#endif
 #endif  /*  __cplusplus  */
 
+#ifndef __cplusplus
 /**
- * Internal macro for defining the <c>EnumName_IsValid()</c> function
- * for an <c>enum</c>.  <c>EnumName</c> and <c>ForeachInEnum</c>
- * should be the same as the values passed into the corresponding call
- * to <c>MAKE_ENUM_DECLARATION()</c>.
+ * C version of internal macro for defining the
+ * <c>EnumName_IsValid()</c> function of a flag enumeration along with
+ * <c>EnumName_MakeEnumMask</c>.  A value is valid if it only has bits
+ * that are in the mask which takes a single AND.  Some valid values
+ * cannot be formed from the elements when an element has more than
+ * one bit, and <c>EnumName_FlagsToString()</c> fails for those.
+ * <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
- * @param X macro to apply to each element
  */
-#define MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(EnumName,      \
-                                             ForeachInEnum, \
-                                             X)             \
-    int                                                     \
-    EnumName##_IsValid(enum EnumName e)                     \
-    {                                                       \
-        int result = 0;                                     \
-        switch (e) {                                        \
-            ForeachInEnum(EnumName, X)                      \
-            result = 1;                                     \
-            break;                                          \
-        default:                                            \
-            result = 0;                                     \
-        }                                                   \
-        return result;                                      \
+#define MAKE_ENUM_FLAGS_IS_VALID_DEFINITION(Specifier,              \
+                                            EnumName,               \
+                                            ForeachInEnum)          \
+    MAKE_ENUM_MASK_DEFINITION(EnumName, ForeachInEnum)              \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_IsValid(enum EnumName e)                             \
+    {                                                               \
+        int result = ((unsigned long)e & ~EnumName##_MakeEnumMask) == 0; \
+        if (!result) {                                              \
+            MAKE_ENUM_COUNT(EnumName, is_valid_failures.value);     \
+        }                                                           \
+        return result;                                              \
     }
+#else
+/**
+ * C++ version of internal macro for defining the
+ * <c>EnumName_IsValid()</c> function of a flag enumeration as well as
+ * an overloaded <c>IsValid()</c> function.  The mask was declared by
+ * <c>MAKE_ENUM_MASK_DECLARATION()</c>.  <c>EnumName</c> and
+ * <c>ForeachInEnum</c> should be the same as the values passed into
+ * the corresponding call to <c>MAKE_ENUM_FLAGS_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_FLAGS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FLAGS_IS_VALID_DEFINITION(Specifier,              \
+                                            EnumName,               \
+                                            ForeachInEnum)          \
+    Specifier int                                                   \
+    EnumName##_IsValid(enum EnumName e)                             \
+    {                                                               \
+        int result = ((unsigned long)e & ~EnumName##_MakeEnumMask) == 0; \
+        if (!result) {                                              \
+            MAKE_ENUM_COUNT(EnumName, is_valid_failures.value);     \
+        }                                                           \
+        return result;                                              \
+    }                                                               \
+                                                                    \
+    MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(Specifier,               \
+                                           EnumName,                \
+                                           ForeachInEnum)
+#endif  /*  __cplusplus  */
 
-#ifdef __cplusplus
 /**
- * Internal macro for defining the overloaded <c>IsValid()</c>
- * function for an <c>enum</c> or an <c>enum class</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c> or
- * <c>MAKE_ENUM_CLASS_DECLARATION()</c>. <p>
+ * Internal macro for defining the <c>EnumName_Encode()</c>,
+ * <c>EnumName_Decode()</c>, <c>EnumName_PackedSize()</c>,
+ * <c>EnumName_Pack()</c>, and <c>EnumName_Unpack()</c> functions of
+ * a flag enumeration.  A combination of flags is not an element, so
+ * it has no index.  Instead, these store the bits of the value.
+ * Encoding writes the value as a varint, and packing stores the low
+ * bits of each value up to the highest bit of
+ * <c>EnumName_MakeEnumMask</c>, least significant bit first.  A value
+ * is rejected on the way in and on the way out if it is not valid,
+ * that is, if it has a bit that is not in the mask.  The mask must
+ * have already been defined by
+ * <c>MAKE_ENUM_FLAGS_IS_VALID_DEFINITION()</c>.
  *
- * This macro works for both <c>enum</c> and <c>enum class</c>
- * enumerations because the enum logic is in the
- * <c>EnumName_FromString()</c> function which is defined
- * elsewhere. <p>
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
  */
-#define MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(EnumName,        \
-                                               ForeachInEnum)   \
-    bool                                                        \
-    IsValid(EnumName e)                                         \
-    {                                                           \
-        return (bool)EnumName##_IsValid(e);                     \
+#define MAKE_ENUM_FLAGS_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)   \
+    Specifier size_t                                                    \
+    EnumName##_Encode(unsigned char* buf,                               \
+                      size_t size,                                      \
+                      enum EnumName e)                                  \
+    {                                                                   \
+        size_t result = 0;                                              \
+        unsigned long bits = (unsigned long)e;                          \
+                                                                        \
+        if (!buf || (bits & ~EnumName##_MakeEnumMask)) {                \
+            goto out;                                                   \
+        }                                                               \
+        do {                                                            \
+            if (result == size) {                                       \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            buf[result++] = (unsigned char)((bits & 0x7f)               \
+                                            | ((bits > 0x7f) ? 0x80 : 0)); \
+            bits >>= 7;                                                 \
+        } while (bits);                                                 \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Decode(enum EnumName* e,                                 \
+                      const unsigned char* buf,                         \
+                      size_t size)                                      \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t max_bytes =                                              \
+            (MakeEnum_BitWidth(EnumName##_MakeEnumMask) + 6) / 7;       \
+        unsigned long bits = 0;                                         \
+        unsigned char byte = 0;                                         \
+                                                                        \
+        if (!e || !buf) {                                               \
+            goto out;                                                   \
+        }                                                               \
+        do {                                                            \
+            if ((result == size) ||                                     \
+                (result == ((max_bytes > 0) ? max_bytes : 1)))          \
+            {                                                           \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            byte = buf[result];                                         \
+            bits |= (unsigned long)(byte & 0x7f) << (7 * result);       \
+            ++result;                                                   \
+        } while (byte & 0x80);                                          \
+        if (bits & ~EnumName##_MakeEnumMask) {                          \
+            result = 0;                                                 \
+            goto out;                                                   \
+        }                                                               \
+        *e = (enum EnumName)bits;                                       \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_PackedSize(size_t count)                                 \
+    {                                                                   \
+        return (count * MakeEnum_BitWidth(EnumName##_MakeEnumMask) + 7) / 8; \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Pack(unsigned char* buf,                                 \
+                    size_t size,                                        \
+                    const enum EnumName* e,                             \
+                    size_t count)                                       \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t i = 0;                                                   \
+        unsigned int width = MakeEnum_BitWidth(EnumName##_MakeEnumMask); \
+        unsigned int left = 0;                                          \
+        unsigned int take = 0;                                          \
+        unsigned long bits = 0;                                         \
+        unsigned int acc = 0;                                           \
+        unsigned int acc_bits = 0;                                      \
+                                                                        \
+        if (!buf || !e || (size < EnumName##_PackedSize(count))) {      \
+            goto out;                                                   \
+        }                                                               \
+        for (i = 0; i < count; ++i) {                                   \
+            bits = (unsigned long)e[i];                                 \
+            if (bits & ~EnumName##_MakeEnumMask) {                      \
+                result = 0;                                             \
+                goto out;                                               \
+            }                                                           \
+            for (left = width; left > 0; left -= take) {                \
+                take = (left < 8 - acc_bits) ? left : 8 - acc_bits;     \
+                acc |= (unsigned int)(bits & ((1UL << take) - 1))       \
+                    << acc_bits;                                        \
+                bits >>= take;                                          \
+                acc_bits += take;                                       \
+                if (acc_bits == 8) {                                    \
+                    buf[result++] = (unsigned char)acc;                 \
+                    acc = 0;                                            \
+                    acc_bits = 0;                                       \
+                }                                                       \
+            }                                                           \
+        }                                                               \
+        if (acc_bits > 0) {                                             \
+            buf[result++] = (unsigned char)acc;                         \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
+    }                                                                   \
+                                                                        \
+    Specifier size_t                                                    \
+    EnumName##_Unpack(enum EnumName* e,                                 \
+                      size_t count,                                     \
+                      const unsigned char* buf,                         \
+                      size_t size)                                      \
+    {                                                                   \
+        size_t result = 0;                                              \
+        size_t pos = 0;                                                 \
+        unsigned int width = MakeEnum_BitWidth(EnumName##_MakeEnumMask); \
+        unsigned int got = 0;                                           \
+        unsigned int take = 0;                                          \
+        unsigned long bits = 0;                                         \
+        unsigned int acc = 0;                                           \
+        unsigned int acc_bits = 0;                                      \
+                                                                        \
+        if (!e || !buf) {                                               \
+            goto out;                                                   \
+        }                                                               \
+        for (result = 0; result < count; ++result) {                    \
+            bits = 0;                                                   \
+            for (got = 0; got < width; got += take) {                   \
+                if (acc_bits == 0) {                                    \
+                    if (pos == size) {                                  \
+                        goto out;                                       \
+                    }                                                   \
+                    acc = buf[pos++];                                   \
+                    acc_bits = 8;                                       \
+                }                                                       \
+                take = (width - got < acc_bits) ? width - got : acc_bits; \
+                bits |= (unsigned long)(acc & ((1U << take) - 1)) << got; \
+                acc >>= take;                                           \
+                acc_bits -= take;                                       \
+            }                                                           \
+            if (bits & ~EnumName##_MakeEnumMask) {                      \
+                goto out;                                               \
+            }                                                           \
+            e[result] = (enum EnumName)bits;                            \
+        }                                                               \
+                                                                        \
+     out:                                                               \
+        return result;                                                  \
     }
-#endif
 
 #ifndef __cplusplus
 /**
  * C version of internal macro for defining the
- * <c>EnumName_IsValid()</c> function for an <c>enum</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions of a flag enumeration.
+ * <c>EnumName</c> should be the same as the values passed into the
+ * corresponding call to <c>MAKE_ENUM_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_IS_VALID_DEFINITION(EnumName,                 \
-                                      ForeachInEnum)            \
-    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(EnumName,              \
-                                       ForeachInEnum,           \
-                                       X_MAKE_ENUM_IS_VALID)
+#define MAKE_ENUM_FLAGS_ENCODE_DEFINITION(Specifier, EnumName)  \
+    MAKE_ENUM_FLAGS_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)
 #else
 /**
  * C++ version of internal macro for defining the
- * <c>EnumName_IsValid()</c> function as well as an overloaded
- * <c>IsValid()</c> function for an <c>enum class</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * <c>EnumName_Encode()</c>, <c>EnumName_Decode()</c>,
+ * <c>EnumName_PackedSize()</c>, <c>EnumName_Pack()</c>, and
+ * <c>EnumName_Unpack()</c> functions of a flag enumeration as well as
+ * overloaded <c>Encode()</c>, <c>Decode()</c>, <c>Pack()</c>, and
+ * <c>Unpack()</c> functions.  <c>EnumName</c> should be the same as
+ * the values passed into the corresponding call to
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_FLAGS_DECLARATION()</c>.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_IS_VALID_DEFINITION(EnumName,                     \
-                                      ForeachInEnum)                \
-    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(EnumName,                  \
-                                         ForeachInEnum,             \
-                                         X_MAKE_ENUM_IS_VALID)      \
-    MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
+#define MAKE_ENUM_FLAGS_ENCODE_DEFINITION(Specifier, EnumName)      \
+    MAKE_ENUM_FLAGS_ENCODE_DEFINITION_BASE_C(Specifier, EnumName)   \
+    MAKE_ENUM_ENCODE_DEFINITION_BASE_CXX(Specifier, EnumName)
+#endif  /*  __cplusplus  */
 
 /**
- * C++ version of internal macro for defining the
- * <c>EnumName_IsValid()</c> function as well as an overloaded
- * <c>IsValid()</c> function for an <c>enum class</c>.
- * <c>EnumName</c> and <c>ForeachInEnum</c> should be the same as the
- * values passed into the corresponding call to
- * <c>MAKE_ENUM_DECLARATION()</c>.
+ * Internal macro for defining the flag helper functions of an
+ * <c>enum</c> or an <c>enum class</c>. <p>
+ *
+ * <c>EnumName_FlagsToString()</c> writes the names of the elements
+ * whose bits are set in <c>e</c> separated by '|' to <c>buf</c>
+ * which holds <c>size</c> bytes.  If any bits of <c>e</c> are in
+ * <c>EnumName_MakeEnumMultiBitMask</c>, it first writes the elements
+ * that have more than one bit set, all of which are set in <c>e</c>,
+ * in the order they are declared.  It then walks the remaining set
+ * bits from lowest to highest with
+ * <c>MAKE_ENUM_COUNT_TRAILING_ZEROS()</c>.  It finds the name of each
+ * element with <c>EnumName_ToStringLen()</c>, so it never scans a
+ * name or allocates.  If <c>e</c> is zero, the name of the element
+ * whose value is zero is written.  If some set bits are left over
+ * that are not the value of a single-bit element, the result is the
+ * empty string.  That happens for values outside the mask, but it
+ * also happens for values that <c>EnumName_IsValid()</c> accepts
+ * because all of their bits are in the mask even though no bitwise
+ * OR of the elements forms them, such as one bit of an element that
+ * has two bits.  Like <c>EnumName_ToStringBatch()</c>, the result is
+ * null terminated if <c>size</c> is not zero, and the return value
+ * is the number of bytes needed not counting the terminating
+ * null. <p>
+ *
+ * <c>EnumName_FlagsFromStringN()</c> scans the <c>n</c> bytes
+ * starting at <c>s</c> for '|' without modifying them, converts each
+ * name between them with <c>EnumName_FromStringN()</c> after trimming
+ * spaces, and sets
+ * <c>e</c> to the bitwise OR of the results.  An empty string is
+ * zero.  It fails without changing <c>e</c> if any name is empty or
+ * not the name of an element.
  *
+ * @param Specifier storage class specifier for the helper functions
  * @param EnumName enumeration name
- * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_CLASS_IS_VALID_DEFINITION(EnumName,               \
-                                            ForeachInEnum)          \
-    MAKE_ENUM_IS_VALID_DEFINITION_BASE_C(EnumName,                  \
-                                       ForeachInEnum,               \
-                                       X_MAKE_ENUM_CLASS_IS_VALID)  \
-    MAKE_ENUM_IS_VALID_DEFINITION_BASE_CXX(EnumName, ForeachInEnum)
+#define MAKE_ENUM_FLAGS_DEFINITION_BASE_C(Specifier, EnumName)      \
+    Specifier size_t                                                \
+    EnumName##_FlagsToString(char* buf,                             \
+                             size_t size,                           \
+                             enum EnumName e,                       \
+                             int with_enum_name)                    \
+    {                                                               \
+        size_t result = 0;                                          \
+        unsigned long rest = (unsigned long)e;                      \
+        unsigned long bit = 0;                                      \
+        const char* name = NULL;                                    \
+        size_t length = 0;                                          \
+        size_t i = 0;                                               \
+                                                                    \
+        do {                                                        \
+            bit = 0;                                                \
+            while ((rest & EnumName##_MakeEnumMultiBitMask)         \
+                   && (i < (size_t)EnumName##_MakeEnumCount)) {     \
+                bit = (unsigned long)EnumName##_MakeEnumEntries[i++].value; \
+                if ((bit & (bit - 1UL)) && ((rest & bit) == bit)) { \
+                    break;                                          \
+                }                                                   \
+                bit = 0;                                            \
+            }                                                       \
+            if ((bit == 0) && (rest != 0)) {                        \
+                bit = 1UL << MAKE_ENUM_COUNT_TRAILING_ZEROS(rest);  \
+            }                                                       \
+            name = EnumName##_ToStringLen((enum EnumName)bit,       \
+                                          with_enum_name,           \
+                                          1,                        \
+                                          &length);                 \
+            if ((length == 0) && (bit != 0)) {                      \
+                result = 0;                                         \
+                goto out;                                           \
+            }                                                       \
+            if (result > 0) {                                       \
+                if (result < size) {                                \
+                    buf[result] = '|';                              \
+                }                                                   \
+                ++result;                                           \
+            }                                                       \
+            if (result < size) {                                    \
+                memcpy(buf + result,                                \
+                       name,                                        \
+                       (length < size - result) ? length : size - result); \
+            }                                                       \
+            result += length;                                       \
+            rest &= ~bit;                                           \
+        } while (rest != 0);                                        \
+                                                                    \
+     out:                                                           \
+        if (size > 0) {                                             \
+            buf[(result < size) ? result : size - 1] = '\0';        \
+        }                                                           \
+        return result;                                              \
+    }                                                               \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FlagsFromString(enum EnumName* e,                    \
+                               const char* s)                       \
+    {                                                               \
+        return EnumName##_FlagsFromStringN(e, s, s ? strlen(s) : 0); \
+    }                                                               \
+                                                                    \
+    Specifier int                                                   \
+    EnumName##_FlagsFromStringN(enum EnumName* e,                   \
+                                const char* s,                      \
+                                size_t n)                           \
+    {                                                               \
+        int result = 0;                                             \
+        unsigned long flags = 0;                                    \
+        enum EnumName flag;                                         \
+        size_t begin = 0;                                           \
+        size_t end = 0;                                             \
+        size_t next = 0;                                            \
+                                                                    \
+        if (!s || !e) {                                             \
+            goto out;                                               \
+        }                                                           \
+        while (next < n) {                                          \
+            begin = next;                                           \
+            end = begin;                                            \
+            while ((end < n) && (s[end] != '|')) {                  \
+                ++end;                                              \
+            }                                                       \
+            next = end + 1;                                         \
+            while ((begin < end) && (s[begin] == ' ')) {            \
+                ++begin;                                            \
+            }                                                       \
+            while ((end > begin) && (s[end - 1] == ' ')) {          \
+                --end;                                              \
+            }                                                       \
+            if (!EnumName##_FromStringN(&flag, s + begin, end - begin)) { \
+                goto out;                                           \
+            }                                                       \
+            flags |= (unsigned long)flag;                           \
+            if (next == n) {                                        \
+                goto out;                                           \
+            }                                                       \
+        }                                                           \
+        *e = (enum EnumName)flags;                                  \
+        result = 1;                                                 \
+                                                                    \
+     out:                                                           \
+        return result;                                              \
+    }
+
+#ifndef __cplusplus
+/**
+ * C version of internal macro for defining the flag helper
+ * functions.  <c>EnumName</c> should be the same as the values passed
+ * into the corresponding call to
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FLAGS_DEFINITION_HELPERS(Specifier, EnumName)     \
+    MAKE_ENUM_FLAGS_DEFINITION_BASE_C(Specifier, EnumName)
+#else
+/**
+ * C++ version of internal macro for defining the flag helper
+ * functions along with the overloaded <c>FlagsToString()</c> and
+ * <c>FlagsFromString()</c> functions.  <c>EnumName</c> should be the
+ * same as the values passed into the corresponding call to
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c> or
+ * <c>MAKE_ENUM_CLASS_FLAGS_DECLARATION()</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FLAGS_DEFINITION_HELPERS(Specifier, EnumName)     \
+    MAKE_ENUM_FLAGS_DEFINITION_BASE_C(Specifier, EnumName)          \
+                                                                    \
+    Specifier size_t                                                \
+    FlagsToString(char* buf,                                        \
+                  size_t size,                                      \
+                  EnumName e,                                       \
+                  bool with_enum_name)                              \
+    {                                                               \
+        return EnumName##_FlagsToString(buf,                        \
+                                        size,                       \
+                                        e,                          \
+                                        with_enum_name);            \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FlagsFromString(EnumName& e,                                    \
+                    const std::string& s)                           \
+    {                                                               \
+        return (bool)EnumName##_FlagsFromStringN(&e,                \
+                                                 s.data(),          \
+                                                 s.size());         \
+    }                                                               \
+                                                                    \
+    Specifier bool                                                  \
+    FlagsFromString(EnumName& e,                                    \
+                    const char* s)                                  \
+    {                                                               \
+        return (bool)EnumName##_FlagsFromString(&e, s);             \
+    }                                                               \
+                                                                    \
+    MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName)
+
+#if MAKE_ENUM_CXX_STD >= 201703L
+/**
+ * C++17 version of internal macro for defining the overloaded
+ * <c>FlagsFromString()</c> function that parses a
+ * <c>std::string_view</c>.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName) \
+    Specifier bool                                                      \
+    FlagsFromString(EnumName& e,                                        \
+                    std::string_view s)                                 \
+    {                                                                   \
+        return (bool)EnumName##_FlagsFromStringN(&e,                    \
+                                                 s.data(),              \
+                                                 s.size());             \
+    }
+#else
+/**
+ * Pre-C++17 version of internal macro for defining the overloaded
+ * <c>FlagsFromString()</c> function that parses a
+ * <c>std::string_view</c>.  It is empty because
+ * <c>std::string_view</c> requires C++17.
+ *
+ * @param Specifier storage class specifier for the helper functions
+ * @param EnumName enumeration name
+ */
+#define MAKE_ENUM_FLAGS_FROM_STRING_VIEW_DEFINITION(Specifier, EnumName)
+#endif
 #endif  /*  __cplusplus  */
 
 /************************************************************************
@@ -836,11 +6110,19 @@
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_DECLARATION(EnumName, ForeachInEnum)          \
-    MAKE_ENUM_DECLARATION_ONLY(enum, EnumName, ForeachInEnum)   \
-    MAKE_ENUM_TO_STRING_DECLARATION(EnumName)                   \
-    MAKE_ENUM_FROM_STRING_DECLARATION(EnumName)                 \
-    MAKE_ENUM_IS_VALID_DECLARATION(EnumName)
+#define MAKE_ENUM_DECLARATION(EnumName, ForeachInEnum)            \
+    MAKE_ENUM_DECLARATION_ONLY(enum, EnumName, ForeachInEnum)     \
+    MAKE_ENUM_INDEX_DECLARATION(EnumName, ForeachInEnum)          \
+    MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)         \
+    MAKE_ENUM_TO_STRING_DECLARATION(MAKE_ENUM_EXTERN,             \
+                                    EnumName,                     \
+                                    ForeachInEnum)                \
+    MAKE_ENUM_FROM_STRING_DECLARATION(MAKE_ENUM_EXTERN, EnumName) \
+    MAKE_ENUM_IS_VALID_DECLARATION(MAKE_ENUM_EXTERN, EnumName)    \
+    MAKE_ENUM_TO_INDEX_DECLARATION(MAKE_ENUM_EXTERN, EnumName)    \
+    MAKE_ENUM_ENCODE_DECLARATION(MAKE_ENUM_EXTERN, EnumName)      \
+    MAKE_ENUM_SCHEMA_HASH_DECLARATION(MAKE_ENUM_EXTERN, EnumName) \
+    MAKE_ENUM_USAGE_DECLARATION(MAKE_ENUM_EXTERN, EnumName)
 
 #ifdef __cplusplus
 /**
@@ -869,9 +6151,17 @@
  */
 #define MAKE_ENUM_CLASS_DECLARATION(EnumName, ForeachInEnum)        \
     MAKE_ENUM_DECLARATION_ONLY(enum class, EnumName, ForeachInEnum) \
-    MAKE_ENUM_CLASS_TO_STRING_DECLARATION(EnumName)                 \
-    MAKE_ENUM_FROM_STRING_DECLARATION(EnumName)                     \
-    MAKE_ENUM_IS_VALID_DECLARATION(EnumName)
+    MAKE_ENUM_INDEX_DECLARATION(EnumName, ForeachInEnum)            \
+    MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)           \
+    MAKE_ENUM_CLASS_TO_STRING_DECLARATION(MAKE_ENUM_EXTERN,         \
+                                          EnumName,                 \
+                                          ForeachInEnum)            \
+    MAKE_ENUM_FROM_STRING_DECLARATION(MAKE_ENUM_EXTERN, EnumName)   \
+    MAKE_ENUM_IS_VALID_DECLARATION(MAKE_ENUM_EXTERN, EnumName)      \
+    MAKE_ENUM_TO_INDEX_DECLARATION(MAKE_ENUM_EXTERN, EnumName)      \
+    MAKE_ENUM_ENCODE_DECLARATION(MAKE_ENUM_EXTERN, EnumName)        \
+    MAKE_ENUM_SCHEMA_HASH_DECLARATION(MAKE_ENUM_EXTERN, EnumName)   \
+    MAKE_ENUM_USAGE_DECLARATION(MAKE_ENUM_EXTERN, EnumName)
 #endif  /*  __cplusplus  */
 
 /************************************************************************
@@ -889,10 +6179,23 @@
  * @param EnumName enumeration name
  * @param ForeachInEnum macro that applies X macro for each element in enum
  */
-#define MAKE_ENUM_DEFINITION(EnumName, ForeachInEnum)           \
-    MAKE_ENUM_TO_STRING_DEFINITION(EnumName, ForeachInEnum)     \
-    MAKE_ENUM_FROM_STRING_DEFINITION(EnumName, ForeachInEnum)   \
-    MAKE_ENUM_IS_VALID_DEFINITION(EnumName, ForeachInEnum)
+#define MAKE_ENUM_DEFINITION(EnumName, ForeachInEnum)            \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)          \
+    MAKE_ENUM_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,             \
+                                   EnumName,                     \
+                                   ForeachInEnum)                \
+    MAKE_ENUM_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                     EnumName,                   \
+                                     ForeachInEnum)              \
+    MAKE_ENUM_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,              \
+                                  EnumName,                      \
+                                  ForeachInEnum)                 \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,              \
+                                  EnumName,                      \
+                                  ForeachInEnum)                 \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)      \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName) \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)
 
 #ifdef __cplusplus
 /**
@@ -908,9 +6211,300 @@
  * @param ForeachInEnum macro that applies X macro for each element in enum
  */
 #define MAKE_ENUM_CLASS_DEFINITION(EnumName, ForeachInEnum)         \
-    MAKE_ENUM_CLASS_TO_STRING_DEFINITION(EnumName, ForeachInEnum)   \
-    MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(EnumName, ForeachInEnum) \
-    MAKE_ENUM_CLASS_IS_VALID_DEFINITION(EnumName, ForeachInEnum)
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)             \
+    MAKE_ENUM_CLASS_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,          \
+                                         EnumName,                  \
+                                         ForeachInEnum)             \
+    MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,        \
+                                           EnumName,                \
+                                           ForeachInEnum)           \
+    MAKE_ENUM_CLASS_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                        EnumName,                   \
+                                        ForeachInEnum)              \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,                 \
+                                  EnumName,                         \
+                                  ForeachInEnum)                    \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)         \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName)    \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)
+#endif  /*  __cplusplus  */
+
+#if defined(__cplusplus) && MAKE_ENUM_CXX_STD >= 201402L
+/**
+ * Same as <c>MAKE_ENUM_DEFINITION()</c> except
+ * <c>EnumName_FromString()</c> is implemented using a perfect hash
+ * that is built at compile time over both the scoped and unscoped
+ * names of the elements.  Converting a string to an enumeration is
+ * then O(1) with a single verifying string compare instead of O(N)
+ * string compares.  This requires C++14.  For C and older versions
+ * of C++, this macro is the same as <c>MAKE_ENUM_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_DEFINITION_HASHED(EnumName, ForeachInEnum)            \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)                 \
+    MAKE_ENUM_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,                    \
+                                   EnumName,                            \
+                                   ForeachInEnum)                       \
+    MAKE_ENUM_HASHED_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                            EnumName,                   \
+                                            ForeachInEnum)              \
+    MAKE_ENUM_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,                     \
+                                  EnumName,                             \
+                                  ForeachInEnum)                        \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,                     \
+                                  EnumName,                             \
+                                  ForeachInEnum)                        \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)             \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName)        \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)
+
+/**
+ * Same as <c>MAKE_ENUM_CLASS_DEFINITION()</c> except
+ * <c>EnumName_FromString()</c> is implemented using a perfect hash
+ * that is built at compile time over both the scoped and unscoped
+ * names of the elements.  This requires C++14.  For older versions of
+ * C++, this macro is the same as <c>MAKE_ENUM_CLASS_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_DEFINITION_HASHED(EnumName, ForeachInEnum)      \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)                 \
+    MAKE_ENUM_CLASS_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,              \
+                                         EnumName,                      \
+                                         ForeachInEnum)                 \
+    MAKE_ENUM_HASHED_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                            EnumName,                   \
+                                            ForeachInEnum)              \
+    MAKE_ENUM_CLASS_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,               \
+                                        EnumName,                       \
+                                        ForeachInEnum)                  \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,                     \
+                                  EnumName,                             \
+                                  ForeachInEnum)                        \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)             \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName)        \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)
+#else
+/**
+ * Same as <c>MAKE_ENUM_DEFINITION()</c>.  The perfect hash requires
+ * C++14.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_DEFINITION_HASHED(EnumName, ForeachInEnum)    \
+    MAKE_ENUM_DEFINITION(EnumName, ForeachInEnum)
+
+#ifdef __cplusplus
+/**
+ * Same as <c>MAKE_ENUM_CLASS_DEFINITION()</c>.  The perfect hash
+ * requires C++14.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_DEFINITION_HASHED(EnumName, ForeachInEnum)  \
+    MAKE_ENUM_CLASS_DEFINITION(EnumName, ForeachInEnum)
+#endif  /*  __cplusplus  */
+#endif  /*  __cplusplus && MAKE_ENUM_CXX_STD >= 201402L  */
+
+/************************************************************************
+ * MAKE_ENUM_FLAGS_DECLARATION() Family of Macros
+ ************************************************************************/
+
+/**
+ * Declare the <c>enum</c> flag enumeration <c>EnumName</c> having
+ * elements <c>ForeachInEnum</c>.  The elements are bits that can be
+ * combined, so in addition to the helper functions declared by
+ * <c>MAKE_ENUM_DECLARATION()</c>, <c>EnumName_FlagsToString()</c>
+ * and <c>EnumName_FlagsFromString()</c> convert combinations such as
+ * "FOO|BAR", and <c>EnumName_IsValid()</c> is true for any
+ * combination of the elements.  For C++, the bitwise operators are
+ * declared too.  This macro belongs in your header file along with
+ * <c>MAKE_ENUM_FLAGS_DEFINITION()</c> in your source file: <p>
+ *
+ * <code>
+ *     #define FOREACH_IN_MY_FLAGS(EnumName, X) \
+ *         X(EnumName, READ, 0x1)               \
+ *         X(EnumName, WRITE, 0x2)              \
+ *         X(EnumName, EXECUTE, 0x4)
+ *     MAKE_ENUM_FLAGS_DECLARATION(MyFlags, FOREACH_IN_MY_FLAGS)
+ * </code>
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FLAGS_DECLARATION(EnumName, ForeachInEnum)        \
+    MAKE_ENUM_DECLARATION(EnumName, ForeachInEnum)                  \
+    MAKE_ENUM_FLAGS_DECLARATION_HELPERS(MAKE_ENUM_EXTERN,           \
+                                        EnumName,                   \
+                                        false)
+
+#ifdef __cplusplus
+/**
+ * Same as <c>MAKE_ENUM_FLAGS_DECLARATION()</c> except for the
+ * <c>enum class</c> flag enumeration <c>EnumName</c>.  The bitwise
+ * operators make combining the elements type safe.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_FLAGS_DECLARATION(EnumName, ForeachInEnum)  \
+    MAKE_ENUM_CLASS_DECLARATION(EnumName, ForeachInEnum)            \
+    MAKE_ENUM_FLAGS_DECLARATION_HELPERS(MAKE_ENUM_EXTERN,           \
+                                        EnumName,                   \
+                                        true)
+#endif  /*  __cplusplus  */
+
+/**
+ * Define the helper functions for the flag enumeration
+ * <c>EnumName</c> having elements <c>ForeachInEnum</c>.  This macro
+ * belongs in your source file along with
+ * <c>MAKE_ENUM_FLAGS_DECLARATION()</c> in your header file.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_FLAGS_DEFINITION(EnumName, ForeachInEnum)         \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)             \
+    MAKE_ENUM_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,                \
+                                   EnumName,                        \
+                                   ForeachInEnum)                   \
+    MAKE_ENUM_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,              \
+                                     EnumName,                      \
+                                     ForeachInEnum)                 \
+    MAKE_ENUM_FLAGS_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                        EnumName,                   \
+                                        ForeachInEnum)              \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,                 \
+                                  EnumName,                         \
+                                  ForeachInEnum)                    \
+    MAKE_ENUM_FLAGS_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)   \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName)    \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)          \
+    MAKE_ENUM_FLAGS_DEFINITION_HELPERS(MAKE_ENUM_EXTERN, EnumName)
+
+#ifdef __cplusplus
+/**
+ * Define the helper functions for the <c>enum class</c> flag
+ * enumeration <c>EnumName</c> having elements <c>ForeachInEnum</c>.
+ * This macro belongs in your source file along with
+ * <c>MAKE_ENUM_CLASS_FLAGS_DECLARATION()</c> in your header file.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_FLAGS_DEFINITION(EnumName, ForeachInEnum)   \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)             \
+    MAKE_ENUM_CLASS_TO_STRING_DEFINITION(MAKE_ENUM_EXTERN,          \
+                                         EnumName,                  \
+                                         ForeachInEnum)             \
+    MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(MAKE_ENUM_EXTERN,        \
+                                           EnumName,                \
+                                           ForeachInEnum)           \
+    MAKE_ENUM_FLAGS_IS_VALID_DEFINITION(MAKE_ENUM_EXTERN,           \
+                                        EnumName,                   \
+                                        ForeachInEnum)              \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_EXTERN,                 \
+                                  EnumName,                         \
+                                  ForeachInEnum)                    \
+    MAKE_ENUM_FLAGS_ENCODE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)   \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_EXTERN, EnumName)    \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_EXTERN, EnumName)          \
+    MAKE_ENUM_FLAGS_DEFINITION_HELPERS(MAKE_ENUM_EXTERN, EnumName)
+#endif  /*  __cplusplus  */
+
+/************************************************************************
+ * MAKE_ENUM_INLINE_DECLARATION() Family of Macros
+ ************************************************************************/
+
+/**
+ * Declare the <c>enum</c> enumeration <c>EnumName</c> having elements
+ * <c>ForeachInEnum</c> and define all of its helper functions in the
+ * header.  This macro is used instead of both
+ * <c>MAKE_ENUM_DECLARATION()</c> and <c>MAKE_ENUM_DEFINITION()</c>.
+ * The helper functions are <c>static</c> and <c>inline</c> so the
+ * optimizer can see through calls to them without link-time
+ * optimization.  For example, <c>EnumName_IsValid()</c> of a constant
+ * can be folded away.  The cost is that each translation unit that
+ * uses the helper functions gets its own copy of them and of the
+ * table of elements.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_INLINE_DECLARATION(EnumName, ForeachInEnum)     \
+    MAKE_ENUM_DECLARATION_ONLY(enum, EnumName, ForeachInEnum)     \
+    MAKE_ENUM_INDEX_DECLARATION(EnumName, ForeachInEnum)          \
+    MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)         \
+    MAKE_ENUM_TO_STRING_DECLARATION(MAKE_ENUM_INLINE,             \
+                                    EnumName,                     \
+                                    ForeachInEnum)                \
+    MAKE_ENUM_FROM_STRING_DECLARATION(MAKE_ENUM_INLINE, EnumName) \
+    MAKE_ENUM_IS_VALID_DECLARATION(MAKE_ENUM_INLINE, EnumName)    \
+    MAKE_ENUM_TO_INDEX_DECLARATION(MAKE_ENUM_INLINE, EnumName)    \
+    MAKE_ENUM_ENCODE_DECLARATION(MAKE_ENUM_INLINE, EnumName)      \
+    MAKE_ENUM_SCHEMA_HASH_DECLARATION(MAKE_ENUM_INLINE, EnumName) \
+    MAKE_ENUM_USAGE_DECLARATION(MAKE_ENUM_INLINE, EnumName)       \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)           \
+    MAKE_ENUM_TO_STRING_DEFINITION(MAKE_ENUM_INLINE,              \
+                                   EnumName,                      \
+                                   ForeachInEnum)                 \
+    MAKE_ENUM_FROM_STRING_DEFINITION(MAKE_ENUM_INLINE,            \
+                                     EnumName,                    \
+                                     ForeachInEnum)               \
+    MAKE_ENUM_IS_VALID_DEFINITION(MAKE_ENUM_INLINE,               \
+                                  EnumName,                       \
+                                  ForeachInEnum)                  \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_INLINE,               \
+                                  EnumName,                       \
+                                  ForeachInEnum)                  \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_INLINE, EnumName)       \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_INLINE, EnumName)  \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_INLINE, EnumName)
+
+#ifdef __cplusplus
+/**
+ * Same as <c>MAKE_ENUM_INLINE_DECLARATION()</c> except for the
+ * <c>enum class</c> enumeration <c>EnumName</c>.  This macro is used
+ * instead of both <c>MAKE_ENUM_CLASS_DECLARATION()</c> and
+ * <c>MAKE_ENUM_CLASS_DEFINITION()</c>.
+ *
+ * @param EnumName enumeration name
+ * @param ForeachInEnum macro that applies X macro for each element in enum
+ */
+#define MAKE_ENUM_CLASS_INLINE_DECLARATION(EnumName, ForeachInEnum)     \
+    MAKE_ENUM_DECLARATION_ONLY(enum class, EnumName, ForeachInEnum)     \
+    MAKE_ENUM_INDEX_DECLARATION(EnumName, ForeachInEnum)                \
+    MAKE_ENUM_TRAITS_DECLARATION(EnumName, ForeachInEnum)               \
+    MAKE_ENUM_CLASS_TO_STRING_DECLARATION(MAKE_ENUM_INLINE,             \
+                                          EnumName,                     \
+                                          ForeachInEnum)                \
+    MAKE_ENUM_FROM_STRING_DECLARATION(MAKE_ENUM_INLINE, EnumName)       \
+    MAKE_ENUM_IS_VALID_DECLARATION(MAKE_ENUM_INLINE, EnumName)          \
+    MAKE_ENUM_TO_INDEX_DECLARATION(MAKE_ENUM_INLINE, EnumName)          \
+    MAKE_ENUM_ENCODE_DECLARATION(MAKE_ENUM_INLINE, EnumName)            \
+    MAKE_ENUM_SCHEMA_HASH_DECLARATION(MAKE_ENUM_INLINE, EnumName)       \
+    MAKE_ENUM_USAGE_DECLARATION(MAKE_ENUM_INLINE, EnumName)             \
+    MAKE_ENUM_TABLE_DEFINITION(EnumName, ForeachInEnum)                 \
+    MAKE_ENUM_CLASS_TO_STRING_DEFINITION(MAKE_ENUM_INLINE,              \
+                                         EnumName,                      \
+                                         ForeachInEnum)                 \
+    MAKE_ENUM_CLASS_FROM_STRING_DEFINITION(MAKE_ENUM_INLINE,            \
+                                           EnumName,                    \
+                                           ForeachInEnum)               \
+    MAKE_ENUM_CLASS_IS_VALID_DEFINITION(MAKE_ENUM_INLINE,               \
+                                        EnumName,                       \
+                                        ForeachInEnum)                  \
+    MAKE_ENUM_TO_INDEX_DEFINITION(MAKE_ENUM_INLINE,                     \
+                                  EnumName,                             \
+                                  ForeachInEnum)                        \
+    MAKE_ENUM_ENCODE_DEFINITION(MAKE_ENUM_INLINE, EnumName)             \
+    MAKE_ENUM_SCHEMA_HASH_DEFINITION(MAKE_ENUM_INLINE, EnumName)        \
+    MAKE_ENUM_USAGE_DEFINITION(MAKE_ENUM_INLINE, EnumName)
 #endif  /*  __cplusplus  */
 
 #endif  /*  MAKE_ENUM_H_LWER8VDLTCWRMVF19GJNGDHC  */
@@ -0,0 +1,293 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "bench_enums.hpp"
+
+// Count every allocation so each benchmark can report allocations
+// per operation along with its time.  The replacements are not
+// inlined so GCC does not mistake the pairing of malloc() with
+// operator delete() for a mismatch.
+#ifdef __GNUC__
+#define BENCH_NOINLINE __attribute__((noinline))
+#else
+#define BENCH_NOINLINE
+#endif
+
+static size_t g_allocations = 0;
+
+BENCH_NOINLINE void*
+operator new(std::size_t n)
+{
+    ++g_allocations;
+    void* p = std::malloc(n ? n : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+BENCH_NOINLINE void
+operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+BENCH_NOINLINE void
+operator delete(void* p,
+                std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// Results are folded into this so the optimizer cannot discard the
+// calls being measured.
+static volatile size_t g_sink = 0;
+
+// Minimum time to spend on each benchmark.
+static std::chrono::milliseconds g_min_duration(100);
+
+// Minimum number of operations per pass over the inputs.  A pass over
+// a larger enumeration performs one operation per element instead.
+static const size_t kOps = 1024;
+
+// Stream buffer that discards its output.
+class NullBuf : public std::streambuf {
+protected:
+    int_type
+    overflow(int_type c) override
+    {
+        return traits_type::not_eof(c);
+    }
+
+    std::streamsize
+    xsputn(const char*,
+           std::streamsize n) override
+    {
+        return n;
+    }
+};
+
+// Stream buffer that reads the same characters on each pass.
+class ArrayBuf : public std::streambuf {
+public:
+    void
+    Reset(std::string& s)
+    {
+        setg(&s[0], &s[0], &s[0] + s.size());
+    }
+};
+
+/**
+ * Run <c>pass</c> which performs <c>ops_per_pass</c> operations until
+ * at least <c>g_min_duration</c> has passed and report the time and
+ * the number of allocations per operation.
+ */
+template <typename F>
+static void
+Run(const char* enum_name,
+    const char* helper,
+    size_t ops_per_pass,
+    F pass)
+{
+    typedef std::chrono::steady_clock Clock;
+    size_t passes = 0;
+    size_t allocations = 0;
+    Clock::duration elapsed;
+
+    // Warm up.
+    pass();
+
+    allocations = g_allocations;
+    Clock::time_point start = Clock::now();
+    do {
+        pass();
+        ++passes;
+        elapsed = Clock::now() - start;
+    } while (elapsed < g_min_duration);
+    allocations = g_allocations - allocations;
+
+    double ops = (double)passes * ops_per_pass;
+    std::printf("%-11s %-32s %10.2f %10.2f\n",
+                enum_name,
+                helper,
+                std::chrono::duration<double, std::nano>(elapsed).count() / ops,
+                allocations / ops);
+}
+
+/**
+ * Run every benchmark for the enumeration <c>E</c>.
+ */
+template <typename E>
+static void
+Bench(const char* enum_name)
+{
+    typedef make_enum::EnumTraits<E> Traits;
+    const size_t ops = (Traits::count > kOps) ? Traits::count : kOps;
+    std::vector<E> valid(ops);
+    std::vector<E> invalid(ops);
+    std::vector<std::string> hits(ops);
+    std::vector<std::string> qualified_hits(ops);
+    std::vector<std::string> misses(ops);
+    std::vector<std::string> lower_hits(ops);
+    std::string words;
+
+    // Visit the elements in a scattered order so the branch predictor
+    // cannot learn the sequence.  The stride is odd, the count is a
+    // power of two, and there are at least as many operations as
+    // elements, so every element is visited.
+    for (size_t i = 0; i < ops; ++i) {
+        E e = Traits::values[(i * 37 + 11) % Traits::count];
+        valid[i] = e;
+        invalid[i] = (E)((unsigned long)Traits::max + 1 + i);
+        hits[i] = ToString(e, false, true);
+        qualified_hits[i] = ToString(e, true, true);
+        misses[i] = hits[i];
+        misses[i][misses[i].size() - 1] = 'x';
+        lower_hits[i] = qualified_hits[i];
+        for (char& c : lower_hits[i]) {
+            if ((c >= 'A') && (c <= 'Z')) {
+                c = (char)(c - 'A' + 'a');
+            }
+        }
+        words += hits[i];
+        words += ' ';
+    }
+
+    Run(enum_name, "FromString (hit)", ops, [&]() {
+        E e;
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + FromString(e, hits[i]);
+        }
+    });
+
+    Run(enum_name, "FromString (qualified hit)", ops, [&]() {
+        E e;
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + FromString(e, qualified_hits[i]);
+        }
+    });
+
+    Run(enum_name, "FromString (miss)", ops, [&]() {
+        E e;
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + FromString(e, misses[i]);
+        }
+    });
+
+    Run(enum_name, "FromStringCI (hit)", ops, [&]() {
+        E e;
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + FromStringCI(e, lower_hits[i]);
+        }
+    });
+
+    Run(enum_name, "ToString (enum, element)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + ToString(valid[i], true, true).size();
+        }
+    });
+
+    Run(enum_name, "ToString (enum)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + ToString(valid[i], true, false).size();
+        }
+    });
+
+    Run(enum_name, "ToString (element)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + ToString(valid[i], false, true).size();
+        }
+    });
+
+    Run(enum_name, "ToString (neither)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + ToString(valid[i], false, false).size();
+        }
+    });
+
+    Run(enum_name, "IsValid (valid)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + IsValid(valid[i]);
+        }
+    });
+
+    Run(enum_name, "IsValid (invalid)", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + IsValid(invalid[i]);
+        }
+    });
+
+    Run(enum_name, "Dispatch", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            g_sink = g_sink + make_enum::Dispatch(valid[i], [](auto tag) {
+                return (size_t)decltype(tag)::value;
+            });
+        }
+    });
+
+    NullBuf null_buf;
+    std::ostream ostrm(&null_buf);
+    Run(enum_name, "operator<<", ops, [&]() {
+        for (size_t i = 0; i < ops; ++i) {
+            ostrm << valid[i];
+        }
+    });
+
+    ArrayBuf array_buf;
+    std::istream istrm(&array_buf);
+    Run(enum_name, "operator>>", ops, [&]() {
+        E e;
+        istrm.clear();
+        array_buf.Reset(words);
+        for (size_t i = 0; i < ops; ++i) {
+            istrm >> e;
+        }
+        g_sink = g_sink + (size_t)istrm.good();
+    });
+
+    std::vector<E> decoded(ops);
+    Run(enum_name, "DecodeColumn", ops, [&]() {
+        size_t consumed = 0;
+        g_sink = g_sink + DecodeColumn(words.data(),
+                                       words.data() + words.size(),
+                                       ' ',
+                                       decoded.data(),
+                                       decoded.size(),
+                                       &consumed);
+    });
+}
+
+int
+main(int argc,
+     char* argv[])
+{
+    // The first argument, if any, is the minimum number of
+    // milliseconds to spend on each benchmark.
+    if (argc > 1) {
+        g_min_duration = std::chrono::milliseconds(std::atoi(argv[1]));
+    }
+
+#ifdef BENCH_HASHED
+    std::printf("FromString(): perfect hash\n");
+#else
+    std::printf("FromString(): binary search\n");
+#endif
+    std::printf("%-11s %-32s %10s %10s\n",
+                "enum", "helper", "ns/op", "allocs/op");
+
+    Bench<Dense8>("Dense8");
+    Bench<Dense64>("Dense64");
+    Bench<Dense512>("Dense512");
+    Bench<Dense4096>("Dense4096");
+
+    Bench<Sparse8>("Sparse8");
+    Bench<Sparse64>("Sparse64");
+    Bench<Sparse512>("Sparse512");
+    Bench<Sparse4096>("Sparse4096");
+
+    return 0;
+}
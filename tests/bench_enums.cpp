@@ -0,0 +1,19 @@
+#include "bench_enums.hpp"
+
+// Build with -DBENCH_HASHED to measure the perfect hash instead of
+// the binary search in FromString().
+#ifdef BENCH_HASHED
+#define BENCH_DEFINITION MAKE_ENUM_CLASS_DEFINITION_HASHED
+#else
+#define BENCH_DEFINITION MAKE_ENUM_CLASS_DEFINITION
+#endif
+
+BENCH_DEFINITION(Dense8, FOREACH_IN_DENSE_8)
+BENCH_DEFINITION(Dense64, FOREACH_IN_DENSE_64)
+BENCH_DEFINITION(Dense512, FOREACH_IN_DENSE_512)
+BENCH_DEFINITION(Dense4096, FOREACH_IN_DENSE_4096)
+
+BENCH_DEFINITION(Sparse8, FOREACH_IN_SPARSE_8)
+BENCH_DEFINITION(Sparse64, FOREACH_IN_SPARSE_64)
+BENCH_DEFINITION(Sparse512, FOREACH_IN_SPARSE_512)
+BENCH_DEFINITION(Sparse4096, FOREACH_IN_SPARSE_4096)
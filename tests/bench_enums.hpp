@@ -0,0 +1,14 @@
+#pragma once
+
+#include "make_enum.h"
+#include "bench_generate.h"
+
+MAKE_ENUM_CLASS_DECLARATION(Dense8, FOREACH_IN_DENSE_8)
+MAKE_ENUM_CLASS_DECLARATION(Dense64, FOREACH_IN_DENSE_64)
+MAKE_ENUM_CLASS_DECLARATION(Dense512, FOREACH_IN_DENSE_512)
+MAKE_ENUM_CLASS_DECLARATION(Dense4096, FOREACH_IN_DENSE_4096)
+
+MAKE_ENUM_CLASS_DECLARATION(Sparse8, FOREACH_IN_SPARSE_8)
+MAKE_ENUM_CLASS_DECLARATION(Sparse64, FOREACH_IN_SPARSE_64)
+MAKE_ENUM_CLASS_DECLARATION(Sparse512, FOREACH_IN_SPARSE_512)
+MAKE_ENUM_CLASS_DECLARATION(Sparse4096, FOREACH_IN_SPARSE_4096)
@@ -0,0 +1,71 @@
+#pragma once
+
+// Generate large enumerations for the benchmarks without listing
+// every element by hand.  Each level expands the level below it 8
+// times, so BENCH_L<k> produces 8^k elements named E_<digits> where
+// the digits are the index of the element in base 8.  The values are
+// passed through Value(index) so the same elements can be dense or
+// sparse.
+#define BENCH_L1(EnumName, X, P, I, Value)      \
+    X(EnumName, P##_0, Value((I) * 8 + 0))      \
+    X(EnumName, P##_1, Value((I) * 8 + 1))      \
+    X(EnumName, P##_2, Value((I) * 8 + 2))      \
+    X(EnumName, P##_3, Value((I) * 8 + 3))      \
+    X(EnumName, P##_4, Value((I) * 8 + 4))      \
+    X(EnumName, P##_5, Value((I) * 8 + 5))      \
+    X(EnumName, P##_6, Value((I) * 8 + 6))      \
+    X(EnumName, P##_7, Value((I) * 8 + 7))
+
+#define BENCH_L2(EnumName, X, P, I, Value)              \
+    BENCH_L1(EnumName, X, P##_0, (I) * 8 + 0, Value)    \
+    BENCH_L1(EnumName, X, P##_1, (I) * 8 + 1, Value)    \
+    BENCH_L1(EnumName, X, P##_2, (I) * 8 + 2, Value)    \
+    BENCH_L1(EnumName, X, P##_3, (I) * 8 + 3, Value)    \
+    BENCH_L1(EnumName, X, P##_4, (I) * 8 + 4, Value)    \
+    BENCH_L1(EnumName, X, P##_5, (I) * 8 + 5, Value)    \
+    BENCH_L1(EnumName, X, P##_6, (I) * 8 + 6, Value)    \
+    BENCH_L1(EnumName, X, P##_7, (I) * 8 + 7, Value)
+
+#define BENCH_L3(EnumName, X, P, I, Value)              \
+    BENCH_L2(EnumName, X, P##_0, (I) * 8 + 0, Value)    \
+    BENCH_L2(EnumName, X, P##_1, (I) * 8 + 1, Value)    \
+    BENCH_L2(EnumName, X, P##_2, (I) * 8 + 2, Value)    \
+    BENCH_L2(EnumName, X, P##_3, (I) * 8 + 3, Value)    \
+    BENCH_L2(EnumName, X, P##_4, (I) * 8 + 4, Value)    \
+    BENCH_L2(EnumName, X, P##_5, (I) * 8 + 5, Value)    \
+    BENCH_L2(EnumName, X, P##_6, (I) * 8 + 6, Value)    \
+    BENCH_L2(EnumName, X, P##_7, (I) * 8 + 7, Value)
+
+#define BENCH_L4(EnumName, X, P, I, Value)              \
+    BENCH_L3(EnumName, X, P##_0, (I) * 8 + 0, Value)    \
+    BENCH_L3(EnumName, X, P##_1, (I) * 8 + 1, Value)    \
+    BENCH_L3(EnumName, X, P##_2, (I) * 8 + 2, Value)    \
+    BENCH_L3(EnumName, X, P##_3, (I) * 8 + 3, Value)    \
+    BENCH_L3(EnumName, X, P##_4, (I) * 8 + 4, Value)    \
+    BENCH_L3(EnumName, X, P##_5, (I) * 8 + 5, Value)    \
+    BENCH_L3(EnumName, X, P##_6, (I) * 8 + 6, Value)    \
+    BENCH_L3(EnumName, X, P##_7, (I) * 8 + 7, Value)
+
+// Dense values are the index of the element.  Sparse values leave a
+// gap of 1008 between neighbors so they are neither sequential nor
+// compact.
+#define BENCH_DENSE(I) (I)
+#define BENCH_SPARSE(I) ((I) * 1009 + 7)
+
+#define FOREACH_IN_DENSE_8(EnumName, X) \
+    BENCH_L1(EnumName, X, E, 0, BENCH_DENSE)
+#define FOREACH_IN_DENSE_64(EnumName, X) \
+    BENCH_L2(EnumName, X, E, 0, BENCH_DENSE)
+#define FOREACH_IN_DENSE_512(EnumName, X) \
+    BENCH_L3(EnumName, X, E, 0, BENCH_DENSE)
+#define FOREACH_IN_DENSE_4096(EnumName, X) \
+    BENCH_L4(EnumName, X, E, 0, BENCH_DENSE)
+
+#define FOREACH_IN_SPARSE_8(EnumName, X) \
+    BENCH_L1(EnumName, X, E, 0, BENCH_SPARSE)
+#define FOREACH_IN_SPARSE_64(EnumName, X) \
+    BENCH_L2(EnumName, X, E, 0, BENCH_SPARSE)
+#define FOREACH_IN_SPARSE_512(EnumName, X) \
+    BENCH_L3(EnumName, X, E, 0, BENCH_SPARSE)
+#define FOREACH_IN_SPARSE_4096(EnumName, X) \
+    BENCH_L4(EnumName, X, E, 0, BENCH_SPARSE)
@@ -0,0 +1,11 @@
+/*
+ * Source compiled by compile_bench.sh to measure the cost of
+ * declaring and defining one large enumeration.  COMPILE_BENCH_FOREACH
+ * names one of the generators in bench_generate.h.  It is valid C and
+ * C++ so the same source is used for both compilers.
+ */
+#include "make_enum.h"
+#include "bench_generate.h"
+
+MAKE_ENUM_DECLARATION(BenchEnum, COMPILE_BENCH_FOREACH)
+MAKE_ENUM_DEFINITION(BenchEnum, COMPILE_BENCH_FOREACH)
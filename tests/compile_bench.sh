@@ -0,0 +1,50 @@
+#!/bin/bash
+#
+# Measure how long it takes to preprocess and compile one enumeration
+# with 64, 512, and 4096 elements, both dense and sparse, with the
+# default expansion and with MAKE_ENUM_LEAN defined.  The C compiler
+# is taken from $CC and the C++ compiler from $CXX.  Times are the
+# wall clock seconds of a single run.
+
+set -e
+
+cd "$(dirname "$0")"
+
+CC=${CC:-cc}
+CXX=${CXX:-c++}
+SIZES=${SIZES:-"64 512 4096"}
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+
+TIMEFORMAT=%R
+
+# Print the wall clock seconds taken by the command.  The output of
+# the command is kept in $OUT/log and printed if the command fails.
+seconds() {
+    if ! { time "$@" > "$OUT/log" 2>&1 ; } 2> "$OUT/time" ; then
+        echo "$0: $* failed:" >&2
+        cat "$OUT/log" >&2
+        exit 1
+    fi
+    cat "$OUT/time"
+}
+
+printf "%-24s %-7s %-5s %-6s %10s %10s %10s\n" \
+       "compiler" "values" "size" "mode" "preproc" "-O0" "-O2"
+for compiler in "$CC -x c" "$CXX -x c++ -std=c++11" "$CXX -x c++ -std=c++17"; do
+    for values in DENSE SPARSE; do
+        for size in $SIZES; do
+            for mode in default lean; do
+                flags="-I../include -DCOMPILE_BENCH_FOREACH=FOREACH_IN_${values}_${size}"
+                if [ "$mode" = lean ]; then
+                    flags="$flags -DMAKE_ENUM_LEAN"
+                fi
+                pp=$(seconds $compiler $flags -E compile_bench.c -o "$OUT/pp")
+                o0=$(seconds $compiler $flags -O0 -c compile_bench.c -o "$OUT/o0.o")
+                o2=$(seconds $compiler $flags -O2 -c compile_bench.c -o "$OUT/o2.o")
+                printf "%-24s %-7s %-5s %-6s %10s %10s %10s\n" \
+                       "$compiler" "$values" "$size" "$mode" "$pp" "$o0" "$o2"
+            done
+        done
+    done
+done
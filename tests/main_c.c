@@ -8,6 +8,10 @@ main(int argc,
     int rv = 0;
     enum MyEnum1 e1;
     enum MyEnum2 e2;
+    enum MyEnum3 e3;
+    enum MyEnum4 e4;
+    enum MyFlags flags;
+    char buf[64];
     const char* s = NULL;
 
     // EnumName_FromString()
@@ -33,12 +37,344 @@ main(int argc,
     printf("    e2 = %s\n", MyEnum2_ToString(e2, 1, 0));
     printf("    e2 = %s\n", MyEnum2_ToString(e2, 0, 1));
 
+    // EnumName_ToStringLen()
+    {
+        size_t n = 0;
+        s = MyEnum2_ToStringLen(e2, 1, 1, &n);
+        printf("EnumName_ToStringLen():\n");
+        printf("    e2 = %.*s (%lu)\n", (int)n, s, (unsigned long)n);
+    }
+
+    // EnumName_ToStringBatch() into a buffer that is large enough and
+    // into one that is too small.
+    {
+        enum MyEnum1 es[3] = { BAZ, FOO, BAR };
+        char buf[32];
+        size_t n = 0;
+
+        printf("EnumName_ToStringBatch():\n");
+        n = MyEnum1_ToStringBatch(es, 3, buf, sizeof(buf), 0, 1, ',');
+        printf("    %s (%lu)\n", buf, (unsigned long)n);
+        n = MyEnum1_ToStringBatch(es, 3, buf, 8, 1, 1, '|');
+        printf("    %s (%lu)\n", buf, (unsigned long)n);
+    }
+
+    // EnumName_FromStringN() parsing a token out of a larger buffer.
+    s = "BAZ,FOO";
+    if (!MyEnum1_FromStringN(&e1, s, 3)) {
+        fprintf(stderr, "*** Error: MyEnum1_FromStringN: %.3s\n", s);
+        rv = 1;
+        goto out;
+    }
+    printf("EnumName_FromStringN():\n");
+    printf("    e1 = %s\n", MyEnum1_ToString(e1, 1, 1));
+
+    // EnumName_FromStringCI() ignoring case and with the alternate
+    // separator.
+    s = "myenum2.eggs";
+    if (!MyEnum2_FromStringCI(&e2, s)) {
+        fprintf(stderr, "*** Error: MyEnum2_FromStringCI: %s\n", s);
+        rv = 1;
+        goto out;
+    }
+    printf("EnumName_FromStringCI():\n");
+    printf("    e2 = %s\n", MyEnum2_ToString(e2, 1, 1));
+
+    // Inline helper functions defined by MAKE_ENUM_INLINE_DECLARATION().
+    s = "GREEN";
+    if (!MyEnum3_FromString(&e3, s)) {
+        fprintf(stderr, "*** Error: MyEnum3_FromString: %s\n", s);
+        rv = 1;
+        goto out;
+    }
+    printf("MAKE_ENUM_INLINE_DECLARATION():\n");
+    printf("    e3 = %s\n", MyEnum3_ToString(e3, 1, 1));
+    printf("    (MyEnum3)15 -> %d\n", MyEnum3_IsValid((enum MyEnum3)15));
+
+    // EnumName_FromStringBatch() with and without lengths.
+    {
+        const char* batch[] = { "BAR", "MyEnum1::FOO", "QUUX", "BAZ,FOO" };
+        size_t lengths[] = { 3, 12, 4, 3 };
+        enum MyEnum1 es[4] = { FOO, FOO, FOO, FOO };
+        unsigned char ok[4] = { 0, 0, 0, 0 };
+        size_t i = 0;
+
+        printf("EnumName_FromStringBatch():\n");
+        printf("    converted = %lu\n",
+               (unsigned long)MyEnum1_FromStringBatch(batch, lengths, 4, es, ok));
+        for (i = 0; i < 4; ++i) {
+            printf("    ok[%lu] = %d, es[%lu] = %s\n",
+                   (unsigned long)i, ok[i],
+                   (unsigned long)i, MyEnum1_ToString(es[i], 1, 1));
+        }
+        printf("    converted = %lu (null terminated)\n",
+               (unsigned long)MyEnum1_FromStringBatch(batch, NULL, 4, es, NULL));
+    }
+
+    // EnumName_DecodeColumn() stopping at a token that is not an
+    // element, at the capacity of the output, and at the end.
+    {
+        const char column[] = "BAR\nMyEnum1::BAZ\nQUUX\nFOO\nBAR";
+        const char* end = column + sizeof(column) - 1;
+        enum MyEnum1 es[4];
+        size_t consumed = 0;
+        size_t n = 0;
+
+        printf("EnumName_DecodeColumn():\n");
+        n = MyEnum1_DecodeColumn(column, end, '\n', es, 4, &consumed);
+        if ((n != 2) || (es[1] != BAZ) || (consumed != 17)) {
+            fprintf(stderr, "*** Error: MyEnum1_DecodeColumn: QUUX\n");
+            rv = 1;
+            goto out;
+        }
+        printf("    converted = %lu, consumed = %lu\n",
+               (unsigned long)n, (unsigned long)consumed);
+        n = MyEnum1_DecodeColumn(column + 22, end, '\n', es, 1, &consumed);
+        if ((n != 1) || (es[0] != FOO) || (consumed != 4)) {
+            fprintf(stderr, "*** Error: MyEnum1_DecodeColumn: cap\n");
+            rv = 1;
+            goto out;
+        }
+        n = MyEnum1_DecodeColumn(column + 26, end, '\n', es, 4, &consumed);
+        if ((n != 1) || (es[0] != BAR) || (column + 26 + consumed != end)) {
+            fprintf(stderr, "*** Error: MyEnum1_DecodeColumn: end\n");
+            rv = 1;
+            goto out;
+        }
+        printf("    last = %s\n", MyEnum1_ToString(es[0], 1, 1));
+    }
+
+    // EnumName_ToIndex() and EnumName_FromIndex() for a sparse enum.
+    printf("EnumName_ToIndex():\n");
+    printf("    BLUE -> %lu\n", (unsigned long)MyEnum3_ToIndex(BLUE));
+    printf("    (MyEnum3)15 -> %lu\n",
+           (unsigned long)MyEnum3_ToIndex((enum MyEnum3)15));
+    if (!MyEnum3_FromIndex(&e3, 1)) {
+        fprintf(stderr, "*** Error: MyEnum3_FromIndex: 1\n");
+        rv = 1;
+        goto out;
+    }
+    printf("EnumName_FromIndex():\n");
+    printf("    1 -> %s\n", MyEnum3_ToString(e3, 1, 1));
+    if (!MyEnum4_FromIndex(&e4, MyEnum4_ToIndex(RESET)) || (e4 != RESET)) {
+        fprintf(stderr, "*** Error: MyEnum4_FromIndex: RESET\n");
+        rv = 1;
+        goto out;
+    }
+    printf("    %lu -> %s\n",
+           (unsigned long)MyEnum4_ToIndex(RESET), MyEnum4_ToString(e4, 1, 1));
+
+    // EnumName_Encode(), EnumName_Decode(), EnumName_Pack(), and
+    // EnumName_Unpack() use the index so each element of MyEnum4
+    // takes 2 bits no matter how large its value is.
+    {
+        enum MyEnum4 es[5] = { HELLO, RESET, GOODBYE, RESET, HELLO };
+        enum MyEnum4 unpacked[5];
+        unsigned char bytes[4];
+        const unsigned char overlong[2] = { 0x80, 0x00 };
+        size_t i = 0;
+
+        if ((MyEnum4_Encode(bytes, sizeof(bytes), RESET) != 1) ||
+            (bytes[0] != 2) ||
+            (MyEnum4_Decode(&e4, bytes, 1) != 1) ||
+            (e4 != RESET) ||
+            (MyEnum4_Encode(bytes, sizeof(bytes), (enum MyEnum4)3) != 0))
+        {
+            fprintf(stderr, "*** Error: MyEnum4_Encode\n");
+            rv = 1;
+            goto out;
+        }
+        bytes[0] = 3;
+        if ((MyEnum4_Decode(&e4, bytes, 1) != 0) ||
+            (MyEnum4_Decode(&e4, overlong, sizeof(overlong)) != 0))
+        {
+            fprintf(stderr, "*** Error: MyEnum4_Decode\n");
+            rv = 1;
+            goto out;
+        }
+        if ((MyEnum4_PackedSize(5) != 2) ||
+            (MyEnum4_Pack(bytes, sizeof(bytes), es, 5) != 2) ||
+            (MyEnum4_Unpack(unpacked, 5, bytes, 2) != 5) ||
+            (MyEnum4_Unpack(unpacked, 5, bytes, 1) != 4))
+        {
+            fprintf(stderr, "*** Error: MyEnum4_Pack\n");
+            rv = 1;
+            goto out;
+        }
+        printf("EnumName_Pack():\n");
+        printf("    %lu bits -> 0x%02x 0x%02x\n",
+               (unsigned long)MyEnum4_MakeEnumBits, bytes[0], bytes[1]);
+        for (i = 0; i < 4; ++i) {
+            if (unpacked[i] != es[i]) {
+                fprintf(stderr, "*** Error: MyEnum4_Unpack: %lu\n",
+                        (unsigned long)i);
+                rv = 1;
+                goto out;
+            }
+        }
+    }
+
+    // EnumName_SchemaHash() must match the C++ version and must not
+    // change unless the names or values change.
+    printf("EnumName_SchemaHash():\n");
+    printf("    MyEnum1 -> 0x%08lx%08lx\n",
+           (unsigned long)(MyEnum1_SchemaHash() >> 32),
+           (unsigned long)(MyEnum1_SchemaHash() & 0xffffffffUL));
+    if ((MyEnum1_SchemaHash() != 0xf8db0d5446ecfc2aULL) ||
+        (MyEnum3_SchemaHash() != 0xad6f5d1c0ffecd2fULL))
+    {
+        fprintf(stderr, "*** Error: EnumName_SchemaHash\n");
+        rv = 1;
+        goto out;
+    }
+
+    // EnumName_FlagsToString() and EnumName_FlagsFromString()
+    printf("EnumName_FlagsToString():\n");
+    MyFlags_FlagsToString(buf, sizeof(buf), (enum MyFlags)(READ | EXECUTE), 0);
+    printf("    READ|EXECUTE -> %s\n", buf);
+    MyFlags_FlagsToString(buf, sizeof(buf), NONE, 1);
+    printf("    NONE -> %s\n", buf);
+    if (MyFlags_FlagsToString(buf, sizeof(buf), (enum MyFlags)0x4, 0) != 0) {
+        fprintf(stderr, "*** Error: MyFlags_FlagsToString: 0x4\n");
+        rv = 1;
+        goto out;
+    }
+    MyOptions_FlagsToString(buf, sizeof(buf), (enum MyOptions)(QUIET | MODE), 0);
+    printf("    QUIET|MODE -> %s\n", buf);
+    if (strcmp(buf, "MODE|QUIET") != 0) {
+        fprintf(stderr, "*** Error: MyOptions_FlagsToString: %s\n", buf);
+        rv = 1;
+        goto out;
+    }
+    MyOptions_FlagsToString(buf, sizeof(buf), (enum MyOptions)(QUIET | FAST), 0);
+    if (strcmp(buf, "QUIET|FAST") != 0) {
+        fprintf(stderr, "*** Error: MyOptions_FlagsToString: %s\n", buf);
+        rv = 1;
+        goto out;
+    }
+    // 0x20 only has bits in the mask, so it is valid, but no
+    // combination of the elements forms it, so it has no name.
+    if (!MyOptions_IsValid((enum MyOptions)0x20) ||
+        (MyOptions_FlagsToString(buf, sizeof(buf), (enum MyOptions)0x20, 0) != 0))
+    {
+        fprintf(stderr, "*** Error: MyOptions_FlagsToString: 0x20\n");
+        rv = 1;
+        goto out;
+    }
+    s = "READ | MyFlags::WRITE";
+    if (!MyFlags_FlagsFromString(&flags, s) || (flags != (READ | WRITE))) {
+        fprintf(stderr, "*** Error: MyFlags_FlagsFromString: %s\n", s);
+        rv = 1;
+        goto out;
+    }
+    printf("EnumName_FlagsFromString():\n");
+    printf("    \"%s\" -> %d\n", s, (int)flags);
+    s = "READ|";
+    if (MyFlags_FlagsFromString(&flags, s)) {
+        fprintf(stderr, "*** Error: MyFlags_FlagsFromString: %s\n", s);
+        rv = 1;
+        goto out;
+    }
+
+    // EnumName_Encode() and EnumName_Pack() store the bits of a flag
+    // enumeration instead of an index, so every valid combination
+    // round trips.  The mask of MyFlags is 0xb, so each value takes
+    // 4 bits.
+    {
+        enum MyFlags fs[3] = { NONE, NONE, EXECUTE };
+        enum MyFlags unpacked[3];
+        unsigned char bytes[4];
+
+        fs[0] = (enum MyFlags)(READ | WRITE);
+        if ((MyFlags_Encode(bytes, sizeof(bytes), fs[0]) != 1) ||
+            (bytes[0] != 0x3) ||
+            (MyFlags_Decode(&flags, bytes, 1) != 1) ||
+            (flags != fs[0]) ||
+            (MyFlags_Encode(bytes, sizeof(bytes), (enum MyFlags)0x4) != 0))
+        {
+            fprintf(stderr, "*** Error: MyFlags_Encode\n");
+            rv = 1;
+            goto out;
+        }
+        bytes[0] = 0x4;
+        if (MyFlags_Decode(&flags, bytes, 1) != 0) {
+            fprintf(stderr, "*** Error: MyFlags_Decode: 0x4\n");
+            rv = 1;
+            goto out;
+        }
+        if ((MyFlags_PackedSize(3) != 2) ||
+            (MyFlags_Pack(bytes, sizeof(bytes), fs, 3) != 2) ||
+            (bytes[0] != 0x03) || (bytes[1] != 0x08) ||
+            (MyFlags_Unpack(unpacked, 3, bytes, 2) != 3) ||
+            (unpacked[0] != fs[0]) || (unpacked[2] != EXECUTE))
+        {
+            fprintf(stderr, "*** Error: MyFlags_Pack\n");
+            rv = 1;
+            goto out;
+        }
+        bytes[0] = 0x43;
+        if (MyFlags_Unpack(unpacked, 3, bytes, 2) != 1) {
+            fprintf(stderr, "*** Error: MyFlags_Unpack: 0x4\n");
+            rv = 1;
+            goto out;
+        }
+    }
+
     printf("-----\n");
 
     // EnumName_IsValidEnum()
     printf("EnumName_IsValidEnum():\n");
     printf("    (MyEnum1)2 -> %d\n", MyEnum1_IsValid((enum MyEnum1)2));
     printf("    (MyEnum2)2 -> %d\n", MyEnum2_IsValid((enum MyEnum2)2));
+    printf("    (MyEnum3)20 -> %d\n", MyEnum3_IsValid((enum MyEnum3)20));
+    printf("    (MyEnum3)21 -> %d\n", MyEnum3_IsValid((enum MyEnum3)21));
+    printf("    (MyFlags)0xb -> %d\n", MyFlags_IsValid((enum MyFlags)0xb));
+    printf("    (MyFlags)0x4 -> %d\n", MyFlags_IsValid((enum MyFlags)0x4));
+
+    // EnumName_IsValid() measures from the smallest value.
+#ifndef MAKE_ENUM_LEAN
+    if (!MyEnum5_MakeEnumIsDense || (MyEnum5_MakeEnumMin != (int)ZERO)) {
+        fprintf(stderr, "*** Error: MyEnum5 is not dense from ZERO\n");
+        rv = 1;
+        goto out;
+    }
+#endif
+    if (!MyEnum5_IsValid(ZERO) ||
+        !MyEnum5_IsValid(THREE) ||
+        MyEnum5_IsValid((enum MyEnum5)-1) ||
+        MyEnum5_IsValid((enum MyEnum5)4))
+    {
+        fprintf(stderr, "*** Error: MyEnum5_IsValid\n");
+        rv = 1;
+        goto out;
+    }
+
+#ifdef MAKE_ENUM_INSTRUMENTED
+    // EnumName_UsageSnapshot() and EnumName_UsageDump()
+    {
+        struct MyEnum1_Usage usage;
+
+        MyEnum1_UsageReset();
+        MyEnum1_FromString(&e1, "BAR");
+        MyEnum1_FromStringCI(&e1, "myenum1.bar");
+        MyEnum1_FromString(&e1, "QUUX");
+        MyEnum1_ToString(BAZ, 1, 1);
+        MyEnum1_IsValid((enum MyEnum1)2);
+        MyEnum1_IsValid((enum MyEnum1)3);
+        MyEnum1_UsageSnapshot(&usage);
+        if ((usage.from_string[MyEnum1_ToIndex(BAR)] != 2) ||
+            (usage.to_string[MyEnum1_ToIndex(BAZ)] != 1) ||
+            (usage.from_string_misses != 1) ||
+            (usage.is_valid_failures != 1))
+        {
+            fprintf(stderr, "*** Error: MyEnum1_UsageSnapshot\n");
+            rv = 1;
+            goto out;
+        }
+        printf("EnumName_UsageDump():\n");
+        MyEnum1_UsageDump(stdout);
+    }
+#endif
 
  out:
 
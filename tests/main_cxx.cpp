@@ -1,8 +1,21 @@
 #include "my_enums.hpp"
+#include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
 
+// Visitor for make_enum::Dispatch() that is specialized for each
+// element of MyEnum4 at compile time.
+struct MyEnum4Visitor
+{
+    template <MyEnum4 V>
+    long
+    operator()(make_enum::EnumConstant<MyEnum4, V>) const
+    {
+        return (long)V / 1000;
+    }
+};
+
 int
 main(int argc,
      char* argv[])
@@ -10,6 +23,7 @@ main(int argc,
     int rv = 0;
     MyEnum1 e1;
     MyEnum2 e2;
+    MyEnum3 e3;
     const char* s = NULL;
 
     try {
@@ -53,6 +67,97 @@ main(int argc,
             throw std::runtime_error(errmsg.str());
         }
     
+        // FromString() defined by MAKE_ENUM_DEFINITION_HASHED() and
+        // MAKE_ENUM_CLASS_DEFINITION_HASHED().
+        {
+            MyEnum6 e6 = APPLE;
+            MyEnum7 e7 = MyEnum7::CIRCLE;
+            if (!FromString(e6, "CHERRY") ||
+                (e6 != CHERRY) ||
+                !FromString(e6, "MyEnum6::BANANA") ||
+                (e6 != BANANA) ||
+                FromString(e6, "BANANAS") ||
+                !FromString(e7, "MyEnum7::SQUARE") ||
+                (e7 != MyEnum7::SQUARE) ||
+                FromString(e7, "MyEnum7::") ||
+                !MyEnum7_FromStringCI(&e7, "myenum7.circle") ||
+                (e7 != MyEnum7::CIRCLE))
+            {
+                throw std::runtime_error("FromString() hashed");
+            }
+        }
+
+        // FromString() finds every scoped and unscoped name and
+        // nothing else no matter how the names are looked up.
+        for (MyEnum3 e : make_enum::EnumTraits<MyEnum3>::values) {
+            if (!FromString(e3, ToString(e, false)) || (e3 != e) ||
+                !FromString(e3, ToString(e, true)) || (e3 != e))
+            {
+                throw std::runtime_error("FromString: " + ToString(e));
+            }
+        }
+        if (FromString(e3, "REX") ||
+            FromString(e3, "BLUEE") ||
+            FromString(e3, "MyEnum3::BLU") ||
+            FromString(e3, ""))
+        {
+            throw std::runtime_error("FromString() found a missing name");
+        }
+
+#if __cplusplus >= 201703L
+        // FromString() from a std::string_view into a larger buffer.
+        std::string_view sv("MyEnum2::SPAM MyEnum2::EGGS");
+        if (!FromString(e2, sv.substr(sv.find(' ') + 1))) {
+            std::ostringstream errmsg;
+            errmsg << "FromString: " << sv;
+            throw std::runtime_error(errmsg.str());
+        }
+#endif
+
+        // FromStringBatch()
+        std::string batch[] = { "MyEnum2::EGGS", "SPAM", "HAM" };
+        MyEnum2 es[3] = { MyEnum2::SPAM, MyEnum2::SPAM, MyEnum2::SPAM };
+        unsigned char ok[3] = { 0, 0, 0 };
+        if ((FromStringBatch(batch, 3, es, ok) != 2) ||
+            !ok[0] || !ok[1] || ok[2] ||
+            (es[0] != MyEnum2::EGGS))
+        {
+            throw std::runtime_error("FromStringBatch()");
+        }
+#if __cplusplus >= 202002L
+        std::string_view views[] = { "SPAM", "MyEnum2::EGGS", "HAM" };
+        if ((FromStringBatch(views, std::span<MyEnum2>(es, 2), ok) != 2) ||
+            !ok[0] || !ok[1] ||
+            (es[0] != MyEnum2::SPAM) || (es[1] != MyEnum2::EGGS))
+        {
+            throw std::runtime_error("FromStringBatch(std::span)");
+        }
+#endif
+
+        // EnumName_DecodeColumn() with a trailing delimiter.
+        std::string column("SPAM,MyEnum2::EGGS,EGGS,");
+        size_t consumed = 0;
+        if ((MyEnum2_DecodeColumn(column.data(),
+                                  column.data() + column.size(),
+                                  ',',
+                                  es,
+                                  3,
+                                  &consumed) != 3) ||
+            (consumed != column.size()) ||
+            (es[0] != MyEnum2::SPAM) ||
+            (es[2] != MyEnum2::EGGS))
+        {
+            throw std::runtime_error("MyEnum2_DecodeColumn()");
+        }
+
+        // FromStringCI()
+        s = "myenum3::Green";
+        if (!FromStringCI(e3, s) || (e3 != MyEnum3::GREEN)) {
+            std::ostringstream errmsg;
+            errmsg << "FromStringCI: " << s;
+            throw std::runtime_error(errmsg.str());
+        }
+
         // ToString() with and without enum name and element name.
         std::cout << "ToString():" << std::endl;
         std::cout << "    e1 = " << ToString(e1) << " (default)" << std::endl;
@@ -64,6 +169,13 @@ main(int argc,
         std::cout << "    e2 = " << ToString(e2, 1, 0) << std::endl;
         std::cout << "    e2 = " << ToString(e2, 0, 1) << std::endl;
 
+        // ToStringView() with and without enum name and element name.
+        std::cout << "ToStringView():" << std::endl;
+        std::cout << "    e1 = " << ToStringView(e1) << " (default)" << std::endl;
+        std::cout << "    e1 = " << ToStringView(e1, 1, 1) << std::endl;
+        std::cout << "    e2 = " << ToStringView(e2) << " (default)" << std::endl;
+        std::cout << "    e2 = " << ToStringView(e2, 0, 1) << std::endl;
+
         // operator>>()
         s = "FOO";
         std::istringstream istrm(s);
@@ -83,12 +195,225 @@ main(int argc,
             errmsg << "operator>>(): " << s;
             throw std::runtime_error(errmsg.str());
         }
+
+        // operator>>() consumes the whole of a token that is longer
+        // than any name before rejecting it.
+        {
+            std::istringstream tokens("MyEnum2::SPAMSPAMSPAM EGGS");
+            MyEnum2 token = MyEnum2::SPAM;
+            tokens >> token;
+            if (!tokens.fail()) {
+                throw std::runtime_error("operator>>(): long token");
+            }
+            tokens.clear();
+            if (!(tokens >> token) || (token != MyEnum2::EGGS)) {
+                throw std::runtime_error("operator>>(): after long token");
+            }
+        }
     
         // operator<<()
         std::cout << "operator<<():" << std::endl;
         std::cout << "    e1 = " << e1 << std::endl;
         std::cout << "    e2 = " << e2 << std::endl;
+
+        // operator<<() honoring the width, fill, and adjustment which
+        // only apply to the next insertion.
+        std::ostringstream padded;
+        padded << std::setw(5) << BAR << '|'
+               << std::left << std::setfill('.') << std::setw(16)
+               << MyEnum2::EGGS << '|' << MyEnum2::EGGS;
+        std::cout << "    " << padded.str() << std::endl;
+        if (padded.str() != "  BAR|MyEnum2::EGGS...|MyEnum2::EGGS") {
+            throw std::runtime_error("operator<<(): " + padded.str());
+        }
     
+#if defined(MAKE_ENUM_FMT) || defined(MAKE_ENUM_STD_FORMAT)
+        // fmt::formatter<> or std::formatter<> with the default,
+        // qualified, and unqualified names along with a width and
+        // fill.
+#ifdef MAKE_ENUM_FMT
+        std::string formatted =
+            fmt::format("{} {:q} {} {:u} [{}] [{:>6}] [{:u*<6}]",
+                        e1, e1, e2, e2, (MyEnum3)15, e1, e2);
+#else
+        std::string formatted =
+            std::format("{} {:q} {} {:u} [{}] [{:>6}] [{:u*<6}]",
+                        e1, e1, e2, e2, (MyEnum3)15, e1, e2);
+#endif
+        std::cout << "formatter<>:" << std::endl;
+        std::cout << "    " << formatted << std::endl;
+        if (formatted !=
+            "FOO MyEnum1::FOO MyEnum2::SPAM SPAM [] [   FOO] [SPAM**]")
+        {
+            throw std::runtime_error("formatter<>: " + formatted);
+        }
+#endif
+
+        // Inline helper functions defined by
+        // MAKE_ENUM_CLASS_INLINE_DECLARATION().
+        s = "MyEnum3::BLUE";
+        if (!FromString(e3, s)) {
+            std::ostringstream errmsg;
+            errmsg << "FromString: " << s;
+            throw std::runtime_error(errmsg.str());
+        }
+        std::cout << "MAKE_ENUM_CLASS_INLINE_DECLARATION():" << std::endl;
+        std::cout << "    e3 = " << e3 << std::endl;
+        std::cout << "    e3 = " << ToString(e3, 0, 1) << std::endl;
+        std::cout << "    (MyEnum3)15 -> " << IsValid((MyEnum3)15)
+                  << std::endl;
+
+        // make_enum::EnumTraits<>
+        typedef make_enum::EnumTraits<MyEnum1> Traits1;
+        static_assert(Traits1::count == 3, "MyEnum1 has 3 elements");
+        static_assert(Traits1::is_dense, "MyEnum1 is dense");
+        std::cout << "EnumTraits<MyEnum1>:" << std::endl;
+        std::cout << "    count = " << Traits1::count << std::endl;
+        std::cout << "    min = " << Traits1::min << std::endl;
+        std::cout << "    max = " << Traits1::max << std::endl;
+        for (size_t i = 0; i < Traits1::count; ++i) {
+            std::cout << "    names[" << i << "] = " << Traits1::names[i]
+                      << ", values[" << i << "] = " << Traits1::values[i]
+                      << std::endl;
+        }
+
+        // make_enum::EnumMap<> and make_enum::EnumSet<>
+        make_enum::EnumMap<MyEnum3, int> counts = {};
+        make_enum::EnumSet<MyEnum3> seen = {};
+        ++counts[MyEnum3::BLUE];
+        ++counts[MyEnum3::BLUE];
+        seen.Insert(MyEnum3::BLUE);
+        seen.Insert(MyEnum3::RED);
+        seen.Insert((MyEnum3)15);
+        if ((counts[MyEnum3::BLUE] != 2) ||
+            counts.Find((MyEnum3)15) ||
+            (seen.Count() != 2) ||
+            !seen.Contains(MyEnum3::RED) ||
+            seen.Contains(MyEnum3::GREEN))
+        {
+            throw std::runtime_error("EnumMap/EnumSet");
+        }
+        std::cout << "EnumSet<MyEnum3>:" << std::endl;
+        seen.ForEach([](MyEnum3 e) {
+            std::cout << "    " << e << " -> " << ToIndex(e) << std::endl;
+        });
+
+        // ToIndex() and FromIndex() for values far apart.
+        std::cout << "ToIndex(MyEnum4):" << std::endl;
+        for (MyEnum4 e : make_enum::EnumTraits<MyEnum4>::values) {
+            MyEnum4 round_trip = MyEnum4::HELLO;
+            if (!FromIndex(round_trip, ToIndex(e)) || (round_trip != e)) {
+                throw std::runtime_error("ToIndex/FromIndex: MyEnum4");
+            }
+            std::cout << "    " << e << " -> " << ToIndex(e) << std::endl;
+        }
+        if (ToIndex((MyEnum4)3000) != make_enum::EnumTraits<MyEnum4>::count) {
+            throw std::runtime_error("ToIndex: (MyEnum4)3000");
+        }
+
+        // make_enum::Dispatch() with and without a fallback for
+        // elements that are not valid.
+        if ((make_enum::Dispatch(MyEnum4::GOODBYE, MyEnum4Visitor()) != 2) ||
+            (make_enum::Dispatch(MyEnum4::RESET, MyEnum4Visitor()) !=
+             0x40000000L / 1000) ||
+            (make_enum::Dispatch((MyEnum4)3000, MyEnum4Visitor()) != 0) ||
+            (make_enum::Dispatch((MyEnum4)3000,
+                                 MyEnum4Visitor(),
+                                 [](MyEnum4) { return -1L; }) != -1))
+        {
+            throw std::runtime_error("Dispatch: MyEnum4");
+        }
+#if __cplusplus >= 201402L
+        std::string visited;
+        for (MyEnum3 e : make_enum::EnumTraits<MyEnum3>::values) {
+            make_enum::Dispatch(e, [&visited](auto tag) {
+                static_assert((int)decltype(tag)::value % 10 == 0,
+                              "tag is a constant expression");
+                visited += ToStringView(tag(), false, true);
+            });
+        }
+        if (visited != "REDGREENBLUE") {
+            throw std::runtime_error("Dispatch: " + visited);
+        }
+#endif
+
+        // Encode(), Decode(), Pack(), and Unpack()
+        {
+            MyEnum3 colors[3] = { MyEnum3::GREEN, MyEnum3::BLUE, MyEnum3::RED };
+            MyEnum3 unpacked[3] = {};
+            unsigned char bytes[2] = {};
+            if ((Encode(bytes, sizeof(bytes), MyEnum3::BLUE) != 1) ||
+                (Decode(e3, bytes, sizeof(bytes)) != 1) ||
+                (e3 != MyEnum3::BLUE) ||
+                (Pack(bytes, sizeof(bytes), colors, 3) != 1) ||
+                (Unpack(unpacked, 3, bytes, 1) != 3) ||
+                (unpacked[0] != MyEnum3::GREEN) ||
+                (unpacked[2] != MyEnum3::RED) ||
+                (Pack(bytes, sizeof(bytes), &e3, 0) != 0))
+            {
+                throw std::runtime_error("Encode/Decode/Pack/Unpack");
+            }
+        }
+
+        // EnumName_SchemaHash() must match the C version.
+#if __cplusplus >= 201402L
+        static_assert(MyEnum3_SchemaHash() == 0xad6f5d1c0ffecd2full,
+                      "MyEnum3 schema hash");
+#endif
+        if ((MyEnum1_SchemaHash() != 0xf8db0d5446ecfc2aull) ||
+            (MyEnum3_SchemaHash() != 0xad6f5d1c0ffecd2full))
+        {
+            throw std::runtime_error("EnumName_SchemaHash()");
+        }
+
+        // Bitwise operators, FlagsToString(), and FlagsFromString()
+        MyFlags flags = MyFlags::READ | MyFlags::EXECUTE;
+        char buf[64];
+        flags |= MyFlags::WRITE;
+        flags &= ~MyFlags::READ;
+        FlagsToString(buf, sizeof(buf), flags);
+        std::cout << "FlagsToString():" << std::endl;
+        std::cout << "    " << buf << std::endl;
+        if (!IsValid(flags) ||
+            IsValid((MyFlags)0x4) ||
+            (FlagsToString(buf, 4, flags, false) != 13) ||
+            (std::string(buf) != "WRI"))
+        {
+            throw std::runtime_error("FlagsToString");
+        }
+        FlagsToString(buf, sizeof(buf), MyOptions::MODE, true);
+        std::cout << "    " << buf << std::endl;
+        if ((std::string(buf) != "MyOptions::MODE") ||
+            (FlagsToString(buf,
+                           sizeof(buf),
+                           MyOptions::QUIET | MyOptions::MODE,
+                           false) != 10) ||
+            (std::string(buf) != "MODE|QUIET"))
+        {
+            throw std::runtime_error("FlagsToString(MyOptions)");
+        }
+        if (!FlagsFromString(flags, std::string("EXECUTE|READ")) ||
+            (flags != (MyFlags::READ ^ MyFlags::EXECUTE)) ||
+            !FlagsFromString(flags, "") ||
+            (flags != MyFlags::NONE) ||
+            FlagsFromString(flags, "READ||WRITE"))
+        {
+            throw std::runtime_error("FlagsFromString");
+        }
+
+        // Encode() and Decode() of a combination of flags.
+        {
+            unsigned char bytes[2] = {};
+            MyFlags decoded = MyFlags::NONE;
+            if ((Encode(bytes, sizeof(bytes),
+                        MyFlags::WRITE | MyFlags::EXECUTE) != 1) ||
+                (Decode(decoded, bytes, sizeof(bytes)) != 1) ||
+                (decoded != (MyFlags::WRITE | MyFlags::EXECUTE)))
+            {
+                throw std::runtime_error("Encode/Decode: MyFlags");
+            }
+        }
+
         // EnumName_IsValid()
         std::cout << "EnumName_IsValid():" << std::endl;
         std::cout << "    (MyEnum1)2 -> "
@@ -106,6 +431,45 @@ main(int argc,
         std::cout << "    (MyEnum2)2 -> " << IsValid((enum MyEnum2)2)
                   << std::endl;
 
+        // IsValid() measures from the smallest value.
+        static_assert(MyEnum5_MakeEnumIsDense, "MyEnum5 is dense");
+        static_assert(MyEnum5_MakeEnumMin == MyEnum5::ZERO,
+                      "MyEnum5 starts at ZERO");
+        if (!IsValid(MyEnum5::ZERO) ||
+            !IsValid(MyEnum5::THREE) ||
+            IsValid((MyEnum5)-1) ||
+            IsValid((MyEnum5)4))
+        {
+            throw std::runtime_error("IsValid(MyEnum5)");
+        }
+
+#ifdef MAKE_ENUM_INSTRUMENTED
+        // EnumName_UsageSnapshot() and EnumName_UsageDump()
+        {
+            MyEnum2_Usage usage;
+            MyEnum2 e;
+            std::ostringstream ostrm;
+
+            MyEnum2_UsageReset();
+            FromString(e, std::string("MyEnum2::EGGS"));
+            FromString(e, "EGGZ");
+            ostrm << MyEnum2::EGGS << ToStringView(MyEnum2::EGGS);
+            IsValid((MyEnum2)42);
+            MyEnum2_UsageSnapshot(&usage);
+            if ((usage.from_string[ToIndex(MyEnum2::EGGS)] != 1) ||
+                (usage.to_string[ToIndex(MyEnum2::EGGS)] != 2) ||
+                (usage.from_string_misses != 1) ||
+                (usage.is_valid_failures != 1))
+            {
+                throw std::runtime_error("MyEnum2_UsageSnapshot");
+            }
+            std::cout << "EnumName_UsageDump():" << std::endl;
+            std::cout.flush();
+            MyEnum2_UsageDump(stdout);
+            fflush(stdout);
+        }
+#endif
+
     } catch (const std::exception& e) {
         std::cerr << "*** Error: " << e.what() << std::endl;
         rv = 1;
@@ -2,3 +2,5 @@
 
 MAKE_ENUM_DEFINITION(MyEnum1, FOREACH_IN_MY_ENUM_1)
 MAKE_ENUM_DEFINITION(MyEnum2, FOREACH_IN_MY_ENUM_2)
+MAKE_ENUM_FLAGS_DEFINITION(MyFlags, FOREACH_IN_MY_FLAGS)
+MAKE_ENUM_FLAGS_DEFINITION(MyOptions, FOREACH_IN_MY_OPTIONS)
@@ -2,3 +2,7 @@
 
 MAKE_ENUM_DEFINITION(MyEnum1, FOREACH_IN_MY_ENUM_1)
 MAKE_ENUM_CLASS_DEFINITION(MyEnum2, FOREACH_IN_MY_ENUM_2)
+MAKE_ENUM_DEFINITION_HASHED(MyEnum6, FOREACH_IN_MY_ENUM_6)
+MAKE_ENUM_CLASS_DEFINITION_HASHED(MyEnum7, FOREACH_IN_MY_ENUM_7)
+MAKE_ENUM_CLASS_FLAGS_DEFINITION(MyFlags, FOREACH_IN_MY_FLAGS)
+MAKE_ENUM_CLASS_FLAGS_DEFINITION(MyOptions, FOREACH_IN_MY_OPTIONS)
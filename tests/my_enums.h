@@ -14,3 +14,40 @@ MAKE_ENUM_DECLARATION(MyEnum1, FOREACH_IN_MY_ENUM_1)
     X(EnumName, SPAM, 0)                        \
     X(EnumName, EGGS, 1)
 MAKE_ENUM_DECLARATION(MyEnum2, FOREACH_IN_MY_ENUM_2)
+
+// Generate MyEnum3 with helper functions defined inline in the header.
+#define FOREACH_IN_MY_ENUM_3(EnumName, X)       \
+    X(EnumName, RED, 10)                        \
+    X(EnumName, GREEN, 20)                      \
+    X(EnumName, BLUE, 30)
+MAKE_ENUM_INLINE_DECLARATION(MyEnum3, FOREACH_IN_MY_ENUM_3)
+
+// Generate MyEnum4 with sparse values far apart.
+#define FOREACH_IN_MY_ENUM_4(EnumName, X)       \
+    X(EnumName, HELLO, 1000)                    \
+    X(EnumName, GOODBYE, 2000)                  \
+    X(EnumName, RESET, 0x40000000)
+MAKE_ENUM_INLINE_DECLARATION(MyEnum4, FOREACH_IN_MY_ENUM_4)
+
+// Generate MyEnum5 with dense values declared out of order.
+#define FOREACH_IN_MY_ENUM_5(EnumName, X)       \
+    X(EnumName, THREE, 3)                       \
+    X(EnumName, ZERO, 0)                        \
+    X(EnumName, ONE, 1)                         \
+    X(EnumName, TWO, 2)
+MAKE_ENUM_INLINE_DECLARATION(MyEnum5, FOREACH_IN_MY_ENUM_5)
+
+// Generate MyFlags whose elements are bits that can be combined.
+#define FOREACH_IN_MY_FLAGS(EnumName, X)        \
+    X(EnumName, NONE, 0)                        \
+    X(EnumName, READ, 0x1)                      \
+    X(EnumName, WRITE, 0x2)                     \
+    X(EnumName, EXECUTE, 0x8)
+MAKE_ENUM_FLAGS_DECLARATION(MyFlags, FOREACH_IN_MY_FLAGS)
+
+// Generate MyOptions whose MODE element has more than one bit.
+#define FOREACH_IN_MY_OPTIONS(EnumName, X)      \
+    X(EnumName, QUIET, 0x1)                     \
+    X(EnumName, FAST, 0x10)                     \
+    X(EnumName, MODE, 0x30)
+MAKE_ENUM_FLAGS_DECLARATION(MyOptions, FOREACH_IN_MY_OPTIONS)